@@ -27,6 +27,7 @@
 #define FREERTOS_CONFIG_H
 
 #include <board.h>
+#include "config.h"
 
 /*-----------------------------------------------------------
  * Application specific definitions.
@@ -42,18 +43,18 @@
 
 /* clang-format off */
 
-#define configSUPPORT_STATIC_ALLOCATION  0
+#define configSUPPORT_STATIC_ALLOCATION  1
 
 #define configUSE_PREEMPTION             1
 #define configUSE_IDLE_HOOK              0
-#define configUSE_TICKLESS_IDLE          0
+#define configUSE_TICKLESS_IDLE          LOW_POWER_MODE /* Sin el tick mientras la tarea activa espera */
 #define configUSE_TICK_HOOK              0
 #define configCPU_CLOCK_HZ               (SystemCoreClock)
 #define configTICK_RATE_HZ               ((TickType_t)1000) // 1000 ticks per second => 1ms tick rate
 #define configMAX_PRIORITIES             (15)
 #define configMINIMAL_STACK_SIZE         ((uint16_t)128)
 #define configAPPLICATION_ALLOCATED_HEAP 0
-#define configTOTAL_HEAP_SIZE            ((size_t)(16 * 1024)) /* 16 Kbytes. */
+#define configTOTAL_HEAP_SIZE            ((size_t)(1 * 1024)) /* Sin uso, todo se reserva al compilar */
 #define configMAX_TASK_NAME_LEN          (16)
 #define configUSE_TRACE_FACILITY         1
 #define configUSE_16_BIT_TICKS           0
@@ -65,14 +66,34 @@
 #define configUSE_MALLOC_FAILED_HOOK     0
 #define configUSE_APPLICATION_TASK_TAG   0
 #define configUSE_COUNTING_SEMAPHORES    1
-#define configGENERATE_RUN_TIME_STATS    0
+#define configGENERATE_RUN_TIME_STATS    RUNTIME_STATS /* Con un temporizador libre de la placa */
+
+/* Run time stats: one load of the free running timer on each context switch. */
+#if RUNTIME_STATS
+void BoardRunTimeInit(void);
+#define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS() BoardRunTimeInit()
+#define portGET_RUN_TIME_COUNTER_VALUE()         (RUNTIME_STATS_TIMER->TC)
+#endif
+
+/* Trace hooks: fixed size records in a RAM ring, see trace.h. */
+#if TRACE
+#include "trace.h"
+#define traceTASK_CREATE(tcb)          TraceTaskName((uint8_t)(tcb)->uxTCBNumber, (tcb)->pcTaskName)
+#define traceTASK_SWITCHED_IN()        TraceRecord(TRACE_TASK_IN, (uint8_t)pxCurrentTCB->uxTCBNumber, 0)
+#define traceTASK_SWITCHED_OUT()       TraceRecord(TRACE_TASK_OUT, (uint8_t)pxCurrentTCB->uxTCBNumber, 0)
+#define traceTASK_NOTIFY_FROM_ISR(...) TraceRecord(TRACE_NOTIFY_ISR, (uint8_t)pxTCB->uxTCBNumber, 0)
+#define traceLOW_POWER_IDLE_BEGIN()                                                                \
+    TraceRecord(TRACE_SLEEP_BEGIN, 0,                                                              \
+                (xExpectedIdleTime > UINT16_MAX) ? UINT16_MAX : (uint16_t)xExpectedIdleTime)
+#define traceLOW_POWER_IDLE_END()      TraceRecord(TRACE_SLEEP_END, 0, 0)
+#endif
 
 /* Co-routine definitions. */
 #define configUSE_CO_ROUTINES           0
 #define configMAX_CO_ROUTINE_PRIORITIES (2)
 
 /* Software timer definitions. */
-#define configUSE_TIMERS             1
+#define configUSE_TIMERS             0
 #define configTIMER_TASK_PRIORITY    (configMAX_PRIORITIES - 3)
 #define configTIMER_QUEUE_LENGTH     10
 #define configTIMER_TASK_STACK_DEPTH (configMINIMAL_STACK_SIZE * 4)
@@ -87,7 +108,7 @@
 #define INCLUDE_vTaskDelayUntil          1
 #define INCLUDE_vTaskDelay               1
 #define INCLUDE_xTaskGetSchedulerState   1
-#define INCLUDE_xTimerPendFunctionCall   1
+#define INCLUDE_xTimerPendFunctionCall   0
 #define INCLUDE_xSemaphoreGetMutexHolder 1
 #define INCLUDE_xTaskGetHandle           1
 #define INCLUDE_eTaskGetState            1
@@ -0,0 +1,179 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, María Ayelén Vega Caro <ayelenvegacaro@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef ACTIVE_H_
+#define ACTIVE_H_
+
+/** @file active.h
+ ** @brief Declaraciones del núcleo de objetos activos que comparten una sola tarea y una sola pila
+ **
+ ** Cada objeto activo tiene una cola de eventos propia, una prioridad y una función que atiende un evento por vez
+ ** hasta terminar, sin bloquearse nunca. El núcleo atiende siempre primero la cola de mayor prioridad que tenga
+ ** eventos, y los tiempos se programan como temporizadores que encolan un evento al vencer. Como ninguna función se
+ ** bloquea, todos los objetos corren sobre la pila de una sola tarea, que duerme hasta que le avisan que hay algo
+ ** nuevo o hasta el próximo temporizador.
+ **
+ ** Los temporizadores están en una rueda jerárquica de 32 ranuras por nivel con un mapa de bits de las ranuras
+ ** ocupadas. Arrancar, detener y vencer un temporizador no dependen de cuántos haya, y el tiempo que pasa sin
+ ** vencimientos no cuesta nada porque solamente se visitan las ranuras ocupadas.
+ **
+ ** El módulo no depende del sistema operativo: el tiempo lo da una función y quien lo use decide cómo esperar.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+#include <stdint.h>
+#include <stdbool.h>
+#include "input_event.h"
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+#define ACTIVE_MAX_OBJECTS  4          ///< Cantidad máxima de objetos activos
+#define ACTIVE_MAX_TIMERS   8          ///< Cantidad máxima de temporizadores
+#define ACTIVE_WHEEL_LEVELS 3          ///< Niveles de la rueda de temporizadores, de 1 ms, 32 ms y 1024 ms por ranura
+#define ACTIVE_NO_DEADLINE  UINT32_MAX ///< Valor de ActiveRun cuando no hay temporizadores corriendo
+
+//! RAM estática del núcleo en bytes como máximo: objetos, temporizadores y las 32 ranuras de cada nivel de la rueda
+#define ACTIVE_RAM                                                                                                     \
+    (ACTIVE_MAX_OBJECTS * (6 * sizeof(void *) + sizeof(active_stats_t)) +                                              \
+     ACTIVE_MAX_TIMERS * (5 * sizeof(void *) + sizeof(input_event_t) + 2 * sizeof(uint32_t)) +                         \
+     ACTIVE_WHEEL_LEVELS * (32 * sizeof(void *) + sizeof(uint32_t)) + 4 * sizeof(void *) + 2 * sizeof(uint32_t))
+
+/* === Public data type declarations =============================================================================== */
+//! Función que devuelve el tiempo actual en milisegundos
+typedef uint32_t (*active_clock_t)(void);
+
+//! Función que atiende un evento hasta terminar, sin bloquearse
+typedef void (*active_handler_t)(const input_event_t * event, void * context);
+
+//! Lugar de la cola de un objeto activo
+typedef struct active_slot_s {
+    input_event_t event;
+    uint32_t posted_at; //!< Momento en que se encoló, para medir la latencia
+} active_slot_t;
+
+//! Contadores de un objeto activo
+typedef struct active_stats_s {
+    uint32_t dispatched;  //!< Eventos atendidos
+    uint32_t dropped;     //!< Eventos perdidos porque la cola estaba llena
+    uint32_t max_latency; //!< Mayor tiempo entre que se encoló un evento y que se empezó a atender
+    uint16_t high_water;  //!< Máxima cantidad de eventos pendientes
+} active_stats_t;
+
+//! Estructura que representa un objeto activo
+typedef struct active_s * active_t;
+
+//! Estructura que representa un temporizador
+typedef struct active_timer_s * active_timer_t;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+/**
+ * @brief Reinicia el núcleo, sin objetos ni temporizadores
+ *
+ * @param clock Función que devuelve el tiempo actual
+ */
+void ActiveInit(active_clock_t clock);
+
+/**
+ * @brief Crea un objeto activo
+ *
+ * @param priority Prioridad del objeto, mayor número es más urgente y no puede repetirse
+ * @param handler Función que atiende los eventos
+ * @param context Argumento de la función
+ * @param queue Lugar para la cola de eventos
+ * @param length Cantidad de eventos que entran en la cola
+ * @return active_t Referencia al objeto creado, o NULL si hubo algún error
+ */
+active_t ActiveCreate(uint8_t priority, active_handler_t handler, void * context, active_slot_t * queue,
+                      uint8_t length);
+
+/**
+ * @brief Encola un evento en un objeto activo, sin esperar nunca
+ *
+ * Solamente se puede llamar desde la tarea del núcleo, es decir desde las funciones de los objetos o antes de
+ * ActiveRun. Las interrupciones avisan a la tarea y la tarea encola.
+ *
+ * @param self Referencia al objeto
+ * @param event Evento a encolar
+ * @return true El evento se encoló
+ * @return false La cola estaba llena y el evento se perdió
+ */
+bool ActivePost(active_t self, const input_event_t * event);
+
+/**
+ * @brief Crea un temporizador detenido que encola un evento en un objeto al vencer
+ *
+ * @param target Objeto que recibe el evento
+ * @param event Evento a encolar, el momento del vencimiento reemplaza a su marca de tiempo
+ * @return active_timer_t Referencia al temporizador creado, o NULL si no quedan temporizadores
+ */
+active_timer_t ActiveTimerCreate(active_t target, const input_event_t * event);
+
+/**
+ * @brief Arranca o vuelve a arrancar un temporizador
+ *
+ * Los temporizadores periódicos vencen a intervalos exactos desde el primer vencimiento, así que no acumulan el
+ * retraso con el que se atiende cada uno.
+ *
+ * @param timer Referencia al temporizador
+ * @param delay Tiempo hasta el primer vencimiento
+ * @param period Tiempo entre vencimientos, 0 si vence una sola vez
+ */
+void ActiveTimerStart(active_timer_t timer, uint32_t delay, uint32_t period);
+
+/**
+ * @brief Detiene un temporizador
+ *
+ * @param timer Referencia al temporizador
+ */
+void ActiveTimerStop(active_timer_t timer);
+
+/**
+ * @brief Encola los temporizadores vencidos y atiende todos los eventos pendientes, de mayor a menor prioridad
+ *
+ * @return uint32_t Tiempo hasta el próximo vencimiento, o ACTIVE_NO_DEADLINE
+ */
+uint32_t ActiveRun(void);
+
+/**
+ * @brief Devuelve los contadores de un objeto activo
+ *
+ * @param self Referencia al objeto
+ * @param stats Donde se copian los contadores
+ */
+void ActiveGetStats(active_t self, active_stats_t * stats);
+
+/**
+ * @brief Devuelve cuántas veces se llamó a ActiveRun, es decir cuántas veces se despertó la tarea del núcleo
+ */
+uint32_t ActiveRuns(void);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ACTIVE_H_ */
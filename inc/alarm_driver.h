@@ -35,6 +35,7 @@ extern "C" {
 #endif
 
 /* === Public macros definitions =================================================================================== */
+#define ALARM_DRIVER_RAM sizeof(void *) ///< RAM estática del driver en bytes, la referencia al grupo de salidas
 
 /* === Public data type declarations =============================================================================== */
 
@@ -45,7 +46,7 @@ extern "C" {
  * @brief Crea el driver de la alrma
  *
  * @param board puntero al objeto board
- * @return clock_alarm_driver_t Puntero al driver creado
+ * @return clock_alarm_driver_t Puntero al driver creado, o NULL si no se pudo agrupar el buzzer con los leds
  */
 clock_alarm_driver_t AlarmDriverCreate(board_t board);
 
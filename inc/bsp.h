@@ -27,6 +27,8 @@ SPDX-License-Identifier: MIT
 /* === Headers files inclusions ==================================================================================== */
 #include "digital.h"
 #include "display.h"
+#include "keypad.h"
+#include "encoder.h"
 /* === Header for C++ compatibility ================================================================================ */
 
 #ifdef __cplusplus
@@ -34,6 +36,17 @@ extern "C" {
 #endif
 
 /* === Public macros definitions =================================================================================== */
+//! Número de cada tecla en el teclado, igual al canal de interrupción de su pin
+#define BOARD_KEY_ACCEPT    0
+#define BOARD_KEY_CANCEL    1
+#define BOARD_KEY_INCREMENT 2
+#define BOARD_KEY_DECREMENT 3
+#define BOARD_KEY_SET_TIME  4
+#define BOARD_KEY_SET_ALARM 5
+#define BOARD_KEYS          6 ///< Cantidad de teclas
+
+//! RAM estática de la placa en bytes como máximo: el objeto placa, las referencias que guarda y la marca de arranque
+#define BOARD_RAM (sizeof(struct board_s) + 5 * sizeof(void *))
 
 /* === Public data type declarations =============================================================================== */
 
@@ -50,6 +63,8 @@ typedef struct board_s {
     digital_input_t accept;
     digital_input_t cancel;
     display_t display;
+    keypad_t keypad;   //!< Flancos de las teclas capturados por interrupciones
+    encoder_t encoder; //!< Encoder rotativo decodificado por interrupciones, NULL si la placa no lo tiene
 } * board_t;
 
 /* === Public variable declarations ================================================================================ */
@@ -59,11 +74,29 @@ typedef struct board_s {
 /**
  * @brief Inicializa la placa y configura entradas y salidas digitales
  *
- * @return board_t Referencia a la placa creada
+ * @return board_t Referencia a la placa creada, o NULL si no se pudieron crear el teclado o la pantalla
  */
 board_t BoardCreate(void);
 void SysTickInit(uint32_t ticks);
 
+/**
+ * @brief Arranca el temporizador libre con el que el sistema operativo mide el tiempo de ejecución de las tareas
+ *
+ * Lo llama el sistema operativo al arrancar el planificador cuando RUNTIME_STATS está habilitado, y el arranque de
+ * las tareas cuando TRACE está habilitado. Las llamadas siguientes no hacen nada.
+ */
+void BoardRunTimeInit(void);
+
+/**
+ * @brief Arranca el watchdog, que reinicia el procesador si no se lo alimenta durante SCAN_WATCHDOG_TIMEOUT_MS
+ */
+void BoardWatchdogStart(void);
+
+/**
+ * @brief Alimenta el watchdog
+ */
+void BoardWatchdogFeed(void);
+
 /* === End of conditional blocks =================================================================================== */
 
 #ifdef __cplusplus
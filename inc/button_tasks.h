@@ -26,8 +26,11 @@ SPDX-License-Identifier: MIT
 
 /* === Headers files inclusions ==================================================================================== */
 #include "FreeRTOS.h"
-#include "digital.h"
-#include "event_groups.h"
+#include "task.h"
+#include "keypad.h"
+#include "gesture.h"
+#include "encoder.h"
+#include "active.h"
 
 /* === Header for C++ compatibility ================================================================================ */
 
@@ -36,54 +39,43 @@ extern "C" {
 #endif
 
 /* === Public macros definitions =================================================================================== */
-#define BUTTON_EVENT_0         (1 << 0)
-#define BUTTON_EVENT_1         (1 << 1)
-#define BUTTON_EVENT_2         (1 << 2)
-#define BUTTON_EVENT_3         (1 << 3)
-#define BUTTON_EVENT_4         (1 << 4)
-#define BUTTON_EVENT_5         (1 << 5)
-
-#define ANY_EVENT              0xFF
-
-#define BUTTON_TASK_STACK_SIZE (2 * configMINIMAL_STACK_SIZE)
+#define INPUT_NOTIFY_BIT (1 << 0) ///< Bit de la notificación con la que las interrupciones despiertan al núcleo
 /* === Public data type declarations =============================================================================== */
 /**
- * @brief Estructura que representa el estado de un botón
- *
- */
-typedef struct {
-    bool pressed;          ///< Indica si el botón esta siendo presionado
-    bool already_pressed;  ///< Indica si ya fue registrado como presionado
-    TickType_t start_time; ///< Momento en que se comenzo a presionar el botón
-    uint32_t delay_ms;
-} button_state_t;
-
-/**
- * @brief Estructura con los argumentos que se deben pasar a las tareas relacionadas con los botones
+ * @brief Estructura con los argumentos que se deben pasar al objeto activo de las teclas
  *
+ * Las pulsaciones y liberaciones del teclado pasan por el reconocedor de gestos, y cada gesto se encola como un evento
+ * de tecla con el número de tecla como código. Los pasos del encoder se encolan como incrementos o decrementos con la
+ * cantidad de pasos.
  */
-typedef struct button_task_args_s {
-    EventGroupHandle_t clock_events;
-    uint8_t event_bit;
-    digital_input_t button;
-    button_state_t * state;
-} * button_task_args_t;
+typedef struct input_task_args_s {
+    active_t target;     //!< Objeto del reloj, que recibe los eventos de teclas y del encoder
+    active_timer_t poll; //!< Temporizador del próximo muestreo o vencimiento de un gesto
+    keypad_t keypad;
+    gesture_t gesture;
+    encoder_t encoder; //!< Encoder rotativo, NULL si la placa no lo tiene
+} * input_task_args_t;
 
 /* === Public variable declarations ================================================================================ */
 
 /* === Public function declarations ================================================================================ */
 /**
- * @brief Genera un evento cuando un boton fue presionado
+ * @brief Objeto activo que procesa los flancos de todas las teclas y los pasos del encoder
  *
- * @param args
+ * Recibe INPUT_KEY_POLL cuando una interrupción de tecla o del encoder despierta al núcleo o cuando vence su
+ * temporizador, que se vuelve a arrancar con el próximo tiempo de muestreo o de algún gesto.
+ *
+ * @param event Evento recibido
+ * @param context Argumentos del objeto
  */
-void ButtonTask(void * args);
+void InputHandler(const input_event_t * event, void * context);
+
 /**
- * @brief Genera un evento cuando un boton fue presionado durante cierta cantidad de tiempo
+ * @brief Despierta a la tarea del núcleo con INPUT_NOTIFY_BIT, se usa como función de aviso del teclado y del encoder
  *
- * @param args
+ * @param context Referencia a la tarea del núcleo de objetos activos
  */
-void ButtonPressedForLongTimeTask(void * args);
+void InputNotifyFromIsr(void * context);
 
 /* === End of conditional blocks =================================================================================== */
 
@@ -93,6 +93,34 @@ extern "C" {
 #define TEC_4_GPIO 1
 #define TEC_4_BIT  9
 
+// Definiciones de los recursos asociados al puerto SPI (SSP1)
+#define SPI_MOSI_PORT 1
+#define SPI_MOSI_PIN  4
+#define SPI_MOSI_FUNC SCU_MODE_FUNC5
+
+#define SPI_SCK_PORT  0xF
+#define SPI_SCK_PIN   4
+#define SPI_SCK_FUNC  SCU_MODE_FUNC0
+
+#define SPI_SSEL_PORT 1
+#define SPI_SSEL_PIN  5
+#define SPI_SSEL_FUNC SCU_MODE_FUNC5
+
+#define SPI_BITRATE   1000000 ///< Frecuencia del reloj SPI en Hz
+
+// Definiciones de los recursos asociados al encoder rotativo, en los pines GPIO0 y GPIO1 de la placa
+#define ENCODER_A_PORT 6
+#define ENCODER_A_PIN  1
+#define ENCODER_A_FUNC SCU_MODE_FUNC0
+#define ENCODER_A_GPIO 3
+#define ENCODER_A_BIT  0
+
+#define ENCODER_B_PORT 6
+#define ENCODER_B_PIN  4
+#define ENCODER_B_FUNC SCU_MODE_FUNC0
+#define ENCODER_B_GPIO 3
+#define ENCODER_B_BIT  3
+
 /* === Public data type declarations =============================================================================== */
 
 /* === Public variable declarations ================================================================================ */
@@ -35,6 +35,13 @@ extern "C" {
 #endif
 
 /* === Public macros definitions =================================================================================== */
+#define CLOCK_CHANGED_SECONDS (1 << 0) ///< Cambiaron los segundos
+#define CLOCK_CHANGED_MINUTES (1 << 1) ///< Cambiaron los minutos o las horas
+#define CLOCK_CHANGED_ALARM   (1 << 2) ///< La alarma empezó o dejó de sonar
+#define CLOCK_NO_CHANGE       UINT32_MAX ///< No hay ningún cambio previsto
+
+//! RAM estática del reloj en bytes como máximo: contadores, hora, alarma y estado
+#define CLOCK_RAM (sizeof(void *) + 8 * sizeof(uint32_t) + 2 * sizeof(clock_time_t))
 
 /* === Public data type declarations =============================================================================== */
 //! Estructura que define el tiempo en BCD
@@ -99,6 +106,39 @@ bool ClockSetTime(clock_t self, const clock_time_t * new_time);
  */
 bool ClockNewTick(clock_t self);
 
+/**
+ * @brief Avanza el reloj hasta la lectura de un contador libre de ticks
+ *
+ * En lugar de contar llamadas mide los ticks transcurridos desde la lectura anterior, así que no pierde tiempo aunque
+ * se llame tarde o muy de vez en cuando. La primera llamada solamente toma la referencia del contador.
+ *
+ * @param self Puntero al objeto reloj
+ * @param counter Lectura actual del contador, que avanza un tick por vez y puede desbordar
+ */
+bool ClockSync(clock_t self, uint32_t counter);
+
+/**
+ * @brief Devuelve lo que cambió desde la consulta anterior y lo borra
+ *
+ * Permite redibujar la hora solamente cuando cambia lo que se muestra, en lugar de consultarla periódicamente.
+ *
+ * @param self Puntero al objeto reloj
+ * @return uint8_t Máscara de CLOCK_CHANGED_*, 0 si no cambió nada
+ */
+uint8_t ClockTakeChanges(clock_t self);
+
+/**
+ * @brief Calcula cuántos ticks faltan para el próximo cambio de alguno de los tipos pedidos
+ *
+ * Para la alarma solamente cuenta el momento en que empieza a sonar, si está habilitada y no está sonando. Sirve para
+ * saber cuánto se puede dormir sin que se pierda un cambio de la pantalla.
+ *
+ * @param self Puntero al objeto reloj
+ * @param changes Máscara de CLOCK_CHANGED_*
+ * @return uint32_t Ticks hasta el próximo cambio, CLOCK_NO_CHANGE si no hay ninguno previsto
+ */
+uint32_t ClockTicksToChange(clock_t self, uint8_t changes);
+
 /**
  * @brief Setea la alarma a una hora dada
  *
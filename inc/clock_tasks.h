@@ -27,11 +27,11 @@ SPDX-License-Identifier: MIT
 /* === Headers files inclusions ==================================================================================== */
 #include "FreeRTOS.h"
 #include "task.h"
-#include "semphr.h"
-#include "event_groups.h"
+#include "active.h"
 #include "display.h"
 #include "bsp.h"
 #include "clock.h"
+#include "display_scan.h"
 
 /* === Header for C++ compatibility ================================================================================ */
 
@@ -40,7 +40,6 @@ extern "C" {
 #endif
 
 /* === Public macros definitions =================================================================================== */
-#define CLOCK_TASK_STACK_SIZE (2 * configMINIMAL_STACK_SIZE)
 
 /* === Public data type declarations =============================================================================== */
 /**
@@ -54,29 +53,81 @@ typedef enum {
     SET_TIME_HOUR,    ///< Modo de configuración de las horas del tiempo
     SET_ALARM_MINUTE, ///< Modo de configuración de los minutos de la alarma
     SET_ALARM_HOUR,   ///< Modo de configuración de las horas de la alarma
+    MODES_COUNT,      ///< Cantidad de modos
 } mode_t;
 
 /**
- * @brief Estructura con los argumentos que se deben enviar a las tareas relacionadas con el reloj
+ * @brief Estructura con los argumentos que se deben enviar al objeto activo del reloj
  *
  */
 typedef struct clock_task_args_s {
     board_t board;
     clock_t clock;
     mode_t current_mode;
-    EventGroupHandle_t clock_events;
-    SemaphoreHandle_t display_mutex;
+    active_t self;    //!< Objeto del reloj, que recibe el fin de las animaciones
+    active_t display; //!< Objeto del refresco, al que se le avisa la actividad
+    active_t timekeeper; //!< Objeto que lleva la hora, al que se le avisa cuando se pudo cambiar la hora o la alarma
+    display_scan_t scan;
+    struct display_animation_s animation; //!< Animación en curso, con la duración de los cuadros en barridos
+    uint8_t hour[2];        //!< Horas que se muestran o se ajustan, en BCD
+    uint8_t minute[2];      //!< Minutos que se muestran o se ajustan, en BCD
+    bool alarm_already_set; //!< La alarma ya se configuró una vez, así que se puede habilitar y deshabilitar
+    bool alarm_was_active;  //!< La alarma estaba sonando en el evento anterior
 } * clock_task_args_t;
+
+//! Argumentos del objeto activo que lleva la hora
+typedef struct timekeeper_args_s {
+    clock_t clock;
+    active_clock_t counter; //!< Contador libre de milisegundos del que se mide el tiempo transcurrido
+    active_timer_t timer;   //!< Temporizador de una vez en el próximo cambio de la hora
+    active_t target;        //!< Objeto del reloj, al que se le avisan los cambios
+    uint8_t changes;        //!< Cambios CLOCK_CHANGED_* que se ven en la pantalla y hay que avisar
+} * timekeeper_args_t;
+
 /* === Public variable declarations ================================================================================ */
 
 /* === Public function declarations ================================================================================ */
 
 /**
- * @brief Tarea que maneja el funcionamiento del reloj
+ * @brief Pone al reloj en el modo inicial, se llama una vez antes de que empiece a recibir eventos
+ *
+ * @param args Argumentos del objeto del reloj
+ */
+void ClockStart(clock_task_args_t args);
+
+/**
+ * @brief Indica qué cambios del reloj se ven en la pantalla y tienen que llegarle al objeto del reloj
+ *
+ * @param args Argumentos del objeto del reloj
+ * @return uint8_t Máscara de CLOCK_CHANGED_*, los segundos solamente si la pantalla los muestra
+ */
+uint8_t ClockViewChanges(clock_task_args_t args);
+
+/**
+ * @brief Objeto activo que lleva la hora, el de mayor prioridad del núcleo
+ *
+ * Con cada evento lleva el reloj hasta el contador de ticks, así que no pierde tiempo aunque se atienda tarde, avisa
+ * al reloj los cambios que se ven y vuelve a programar su temporizador en el próximo cambio o en la alarma. No
+ * refresca la pantalla, así que ni las demoras del refresco ni las de la pantalla le cuestan ticks al reloj.
+ *
+ * @param event Evento recibido, cualquiera vuelve a sincronizar
+ * @param context Argumentos del objeto
+ */
+void TimekeeperHandler(const input_event_t * event, void * context);
+
+/**
+ * @brief Objeto activo que maneja el funcionamiento del reloj
+ *
+ * Atiende un evento por llamada y después vuelve a dibujar el modo actual. No tiene temporizadores periódicos: se
+ * despierta con las teclas y el encoder, con INPUT_CLOCK_CHANGED cuando cambia la hora que se muestra, con el fin de
+ * las animaciones y con el tiempo de inactividad, que solamente corre después de una actividad. Reenvía los cambios
+ * de la hora al refresco, ya dibujados, y le pide al objeto que lleva la hora que vuelva a planificar después de las
+ * teclas, que pueden cambiar la hora o la alarma.
  *
- * @param pointer
+ * @param event Evento recibido
+ * @param context Argumentos del objeto
  */
-void ClockTask(void * pointer);
+void ClockHandler(const input_event_t * event, void * context);
 
 /* === End of conditional blocks =================================================================================== */
 
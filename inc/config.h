@@ -21,7 +21,7 @@ SPDX-License-Identifier: MIT
 #define CONFIG_H_
 
 /** @file config.h
- ** @brief 
+ ** @brief Opciones de configuración del proyecto que se eligen al compilar
  **/
 
 /* === Headers files inclusions ==================================================================================== */
@@ -33,6 +33,119 @@ extern "C" {
 #endif
 
 /* === Public macros definitions =================================================================================== */
+#ifndef BOARD_DISPLAY_MAX7219
+#define BOARD_DISPLAY_MAX7219 0 ///< 1 si la pantalla está conectada a un MAX7219 por SPI en lugar de multiplexada
+#endif
+
+#ifndef BOARD_DISPLAY_DIGITS
+#define BOARD_DISPLAY_DIGITS 4 ///< Dígitos de la pantalla: 4 muestra HHMM, 6 HHMMSS y 8 HH-MM-SS
+#endif
+
+#ifndef BOARD_ENCODER
+#define BOARD_ENCODER 0 ///< 1 si hay un encoder rotativo conectado a los pines GPIO0 y GPIO1 de la placa
+#endif
+
+#ifndef LOW_POWER_MODE
+#define LOW_POWER_MODE 0 ///< 1 para dormir sin el tick hasta el próximo cambio cuando la pantalla no necesita barrido
+#endif
+
+#ifndef PROFILE
+#define PROFILE 0 ///< 1 para medir en ciclos los caminos críticos con el contador DWT CYCCNT
+#endif
+
+#ifndef TRACE
+#define TRACE 0 ///< 1 para registrar los cambios de tarea y los eventos de los objetos activos en un anillo en RAM
+#endif
+
+#ifndef SCAN_WATCHDOG
+#define SCAN_WATCHDOG 0 ///< 1 para reiniciar con el watchdog cuando el barrido de la pantalla no da abasto
+#endif
+
+#if SCAN_WATCHDOG && LOW_POWER_MODE
+#error "Con LOW_POWER_MODE se duerme más de lo que aguanta el watchdog sin alimentarlo"
+#endif
+#if SCAN_WATCHDOG && BOARD_DISPLAY_MAX7219
+#error "El MAX7219 barre la pantalla solo, así que no hay barridos que alimenten el watchdog"
+#endif
+
+#ifndef RUNTIME_STATS
+#define RUNTIME_STATS 0 ///< 1 para medir el uso del procesador, la pila y el heap de cada tarea
+#endif
+
+#define MAX7219_INTENSITY     8 ///< Brillo de la pantalla cuando se usa el MAX7219, entre 0 y 15
+
+#if BOARD_DISPLAY_DIGITS != 4 && BOARD_DISPLAY_DIGITS != 6 && BOARD_DISPLAY_DIGITS != 8
+#error "BOARD_DISPLAY_DIGITS debe ser 4, 6 u 8"
+#endif
+#if BOARD_DISPLAY_DIGITS != 4 && !BOARD_DISPLAY_MAX7219
+#error "El poncho multiplexado tiene 4 dígitos, las pantallas de 6 u 8 dígitos usan el MAX7219"
+#endif
+
+#define KEYPAD_SCAN_MS 5 ///< Período en ms del muestreo de las teclas, se necesitan 4 muestras iguales para un cambio
+
+// Gestos de las teclas
+#define GESTURE_DOUBLE_MS       300 ///< Tiempo máximo en ms entre soltar y volver a presionar en una doble pulsación
+#define GESTURE_CHORD_MS        50  ///< Tiempo máximo en ms entre las dos pulsaciones de un acorde
+#define GESTURE_REPEAT_DELAY_MS 400 ///< Tiempo presionada en ms hasta la primera repetición
+#define GESTURE_REPEAT_START_MS 150 ///< Período en ms de las primeras repeticiones
+#define GESTURE_REPEAT_MIN_MS   25  ///< Período mínimo en ms de las repeticiones
+#define GESTURE_REPEAT_ACCEL    15  ///< Porcentaje en que se acorta el período después de cada repetición
+
+// Encoder rotativo
+#define ENCODER_TRANSITIONS  4   ///< Transiciones en cuadratura entre dos retenes del encoder
+#define ENCODER_MEDIUM_MS    100 ///< Tiempo máximo en ms entre pasos para avanzar de a ENCODER_MEDIUM_SCALE
+#define ENCODER_FAST_MS      30  ///< Tiempo máximo en ms entre pasos para avanzar de a ENCODER_FAST_SCALE
+#define ENCODER_MEDIUM_SCALE 2   ///< Valores que avanza cada paso a velocidad media
+#define ENCODER_FAST_SCALE   5   ///< Valores que avanza cada paso a velocidad alta
+
+// Objetos que se reservan al compilar en lugar de pedirlos al heap
+#ifndef DIGITAL_OUTPUTS_POOL_SIZE
+#define DIGITAL_OUTPUTS_POOL_SIZE 4 ///< Salidas digitales: buzzer y tres leds
+#endif
+#ifndef DIGITAL_INPUTS_POOL_SIZE
+#define DIGITAL_INPUTS_POOL_SIZE (6 + 2 * BOARD_ENCODER) ///< Entradas digitales: las seis teclas y el encoder
+#endif
+#ifndef DIGITAL_GROUPS_POOL_SIZE
+#define DIGITAL_GROUPS_POOL_SIZE (1 + BOARD_ENCODER) ///< Grupos de entradas y también de salidas digitales
+#endif
+
+// Memoria de la aplicación, toda reservada al compilar. No cuenta las listas internas de FreeRTOS ni las variables
+// de la biblioteca del chip, que no dependen de esta configuración
+#ifndef RAM_BUDGET
+#define RAM_BUDGET (12 * 1024) ///< Bytes de RAM para las tareas, sus colas, el heap y los objetos de todos los módulos
+#endif
+
+// Estadísticas de ejecución, que solamente se toman con RUNTIME_STATS, y marcas de tiempo del registro con TRACE
+#define RUNTIME_STATS_TIMER     LPC_TIMER1    ///< Temporizador libre que mide el tiempo de ejecución de las tareas
+#define RUNTIME_STATS_TIMER_CLK CLK_MX_TIMER1 ///< Reloj del temporizador de las estadísticas
+#define RUNTIME_STATS_HZ        1000000       ///< Cuentas por segundo, da la vuelta a los 71 minutos
+#define RUNTIME_STATS_PERIOD_MS 1000          ///< Tiempo entre muestras, que despierta al procesador si dormía
+#define RUNTIME_STATS_DUMP_SIZE 160           ///< Bytes del texto que se vuelca al pedirlo con el depurador
+
+// Objetos activos, que comparten la tarea del núcleo
+#define INPUT_QUEUE_LENGTH      4  ///< Eventos que se pueden guardar sin procesar en el objeto de las teclas
+#define REFRESH_QUEUE_LENGTH    4  ///< Eventos que se pueden guardar sin procesar en el objeto de refresco
+#define CLOCK_QUEUE_LENGTH      16 ///< Eventos que se pueden guardar sin procesar en el objeto del reloj
+#define TIMEKEEPER_QUEUE_LENGTH 2  ///< Eventos que se pueden guardar sin procesar en el objeto que lleva la hora
+
+// Tiempos del reloj, que vencen como temporizadores de los objetos activos
+#define INACTIVITY_TIMEOUT_MS 30000 ///< Tiempo máximo de inactividad en ms antes de salir de los modos de ajuste
+
+// Planificación del barrido de la pantalla
+#define DISPLAY_SCAN_FLICKER_FREE_HZ {60, 70, 80, 100} ///< Barridos por segundo sin parpadeo para cada nivel de brillo
+#define DISPLAY_SCAN_BRIGHTNESS      3                 ///< Nivel de brillo de la pantalla
+#define DISPLAY_SCAN_IDLE_DIVIDER    2                 ///< Cuántas veces se alarga el período de refresco en reposo
+#define DISPLAY_SCAN_IDLE_TIMEOUT    60000             ///< Inactividad en ms hasta reducir la frecuencia, 0 nunca
+#define DISPLAY_SCAN_BLANK_TIMEOUT   0                 ///< Inactividad en ms hasta apagar la pantalla, 0 nunca
+#define DISPLAY_SCAN_BLANK_PERIOD    500               ///< Período en ms de despertar con la pantalla apagada
+
+// Monitor de los vencimientos del barrido y watchdog
+#define SCAN_MONITOR_WINDOW          1000    ///< Barridos de cada ventana donde se cuentan los vencimientos perdidos
+#define SCAN_MONITOR_OVERRUN_MISSES  10      ///< Vencimientos perdidos en una ventana para considerarla sobrecargada
+#define SCAN_MONITOR_DEGRADE_WINDOWS 3       ///< Ventanas sobrecargadas seguidas para bajar la frecuencia de barrido
+#define SCAN_MONITOR_RESET_WINDOWS   10      ///< Ventanas sobrecargadas seguidas para dejar vencer el watchdog
+#define SCAN_WATCHDOG_TIMEOUT_MS     2000    ///< Tiempo sin alimentar el watchdog hasta el reinicio, más que un período
+#define SCAN_WATCHDOG_CLOCK_HZ       3000000 ///< Cuentas por segundo del watchdog, el oscilador interno dividido por 4
 
 /* === Public data type declarations =============================================================================== */
 
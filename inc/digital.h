@@ -35,6 +35,25 @@ extern "C" {
 #endif
 
 /* === Public macros definitions =================================================================================== */
+#define DIGITAL_GROUP_MAX_INPUTS  16     ///< Cantidad máxima de entradas de un grupo
+#define DIGITAL_GROUP_MAX_OUTPUTS 16     ///< Cantidad máxima de salidas de un grupo
+#define DIGITAL_GROUP_MAX_PORTS   4      ///< Cantidad máxima de puertos distintos en un grupo
+#define DIGITAL_GROUP_ALL         0xFFFF ///< Todas las salidas de un grupo
+
+//! RAM estática de los pools de entradas, salidas y grupos en bytes, con los tamaños de config.h
+#define DIGITAL_RAM                                                                                                    \
+    (DIGITAL_OUTPUTS_POOL_SIZE * 2 + DIGITAL_INPUTS_POOL_SIZE * 4 + 4 +                                                \
+     DIGITAL_GROUPS_POOL_SIZE * (12 + 16 * DIGITAL_GROUP_MAX_PORTS + 5 * DIGITAL_GROUP_MAX_OUTPUTS +                   \
+                                 2 * DIGITAL_GROUP_MAX_INPUTS))
+
+//! Entradas activas en el valor leído de un grupo, un bit por entrada en el orden de creación
+#define DIGITAL_GROUP_ACTIVE(value)      ((uint16_t)(value))
+//! Entradas que cambiaron desde la lectura anterior del grupo
+#define DIGITAL_GROUP_CHANGED(value)     ((uint16_t)((value) >> 16))
+//! Entradas que se activaron desde la lectura anterior del grupo
+#define DIGITAL_GROUP_ACTIVATED(value)   (DIGITAL_GROUP_ACTIVE(value) & DIGITAL_GROUP_CHANGED(value))
+//! Entradas que se desactivaron desde la lectura anterior del grupo
+#define DIGITAL_GROUP_DEACTIVATED(value) ((uint16_t)~DIGITAL_GROUP_ACTIVE(value) & DIGITAL_GROUP_CHANGED(value))
 
 /* === Public data type declarations =============================================================================== */
 
@@ -51,6 +70,12 @@ typedef struct digital_output_s * digital_output_t;
 //! Estructura que representa una entrada digital
 typedef struct digital_input_s * digital_input_t;
 
+//! Estructura que representa un grupo de entradas digitales que se leen juntas
+typedef struct digital_input_group_s * digital_input_group_t;
+
+//! Estructura que representa un grupo de salidas digitales que se escriben juntas
+typedef struct digital_output_group_s * digital_output_group_t;
+
 /* === Public variable declarations ================================================================================ */
 
 /* === Public function declarations ================================================================================ */
@@ -83,6 +108,43 @@ void DigitalOutputDeactivate(digital_output_t self);
  */
 void DigitalOutputToggle(digital_output_t self);
 
+/**
+ * @brief Crea un grupo con salidas digitales ya creadas
+ *
+ * Las salidas de un mismo puerto cambian juntas con una sola escritura del registro de activación o de desactivación
+ * de ese puerto.
+ *
+ * @param outputs Salidas del grupo, la salida n corresponde al bit n de las máscaras
+ * @param count Cantidad de salidas, como máximo DIGITAL_GROUP_MAX_OUTPUTS
+ * @return digital_output_group_t Referencia al grupo creado, o NULL si falta alguna salida o usa más de
+ * DIGITAL_GROUP_MAX_PORTS puertos
+ */
+digital_output_group_t DigitalOutputGroupCreate(const digital_output_t outputs[], uint8_t count);
+
+/**
+ * @brief Activa varias salidas del grupo al mismo tiempo
+ *
+ * @param self Referencia al grupo
+ * @param outputs Salidas a activar, un bit por salida, o DIGITAL_GROUP_ALL
+ */
+void DigitalOutputGroupActivate(digital_output_group_t self, uint16_t outputs);
+
+/**
+ * @brief Desactiva varias salidas del grupo al mismo tiempo
+ *
+ * @param self Referencia al grupo
+ * @param outputs Salidas a desactivar, un bit por salida, o DIGITAL_GROUP_ALL
+ */
+void DigitalOutputGroupDeactivate(digital_output_group_t self, uint16_t outputs);
+
+/**
+ * @brief Deja activas las salidas indicadas y desactiva el resto del grupo
+ *
+ * @param self Referencia al grupo
+ * @param active Salidas que quedan activas, un bit por salida
+ */
+void DigitalOutputGroupWrite(digital_output_group_t self, uint16_t active);
+
 /**
  * @brief Función para crear una entrada digital
  *
@@ -130,6 +192,28 @@ bool DigitalInputWasDeactivated(digital_input_t self);
  */
 digital_state_t DigitalInputWasChanged(digital_input_t self);
 
+/**
+ * @brief Crea un grupo con entradas digitales ya creadas
+ *
+ * Cada puerto que usan las entradas se lee una sola vez por lectura del grupo, y la lógica inversa de todas las
+ * entradas de un puerto se aplica con una única operación.
+ *
+ * @param inputs Entradas del grupo, la entrada n queda en el bit n del valor leído
+ * @param count Cantidad de entradas, como máximo DIGITAL_GROUP_MAX_INPUTS
+ * @return digital_input_group_t Referencia al grupo creado, o NULL si falta alguna entrada o usa más de
+ * DIGITAL_GROUP_MAX_PORTS puertos
+ */
+digital_input_group_t DigitalInputGroupCreate(const digital_input_t inputs[], uint8_t count);
+
+/**
+ * @brief Lee todas las entradas del grupo
+ *
+ * @param self Referencia al grupo
+ * @return uint32_t Estado y cambios de todas las entradas, se separan con DIGITAL_GROUP_ACTIVE, DIGITAL_GROUP_CHANGED,
+ * DIGITAL_GROUP_ACTIVATED y DIGITAL_GROUP_DEACTIVATED
+ */
+uint32_t DigitalInputGroupRead(digital_input_group_t self);
+
 /* === End of conditional blocks =================================================================================== */
 
 #ifdef __cplusplus
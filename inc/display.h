@@ -35,6 +35,22 @@ extern "C" {
 #endif
 
 /* === Public macros definitions =================================================================================== */
+#ifndef DISPLAY_MAX_DIGITS
+#define DISPLAY_MAX_DIGITS 8 ///< Cantidad máxima de dígitos que puede manejar un display
+#endif
+
+#ifndef DISPLAY_MAX_EFFECTS
+#define DISPLAY_MAX_EFFECTS 4 ///< Cantidad de efectos distintos que pueden estar activos al mismo tiempo
+#endif
+
+//! RAM estática de la pantalla en bytes como máximo: efectos, valores, último cuadro y la animación en curso
+#define DISPLAY_RAM (6 * sizeof(void *) + DISPLAY_MAX_EFFECTS * 8 + 2 * DISPLAY_MAX_DIGITS + 4 * sizeof(uint32_t))
+
+#define DISPLAY_BLANK 10 ///< Valor para DisplayWrite que deja el dígito apagado
+#define DISPLAY_DASH  11 ///< Valor para DisplayWrite que muestra un guión
+
+#define DISPLAY_NO_CHANGE UINT16_MAX ///< Lo que se ve en la pantalla no cambia solo
+
 #define SEGMENT_A (1 << 0)
 #define SEGMENT_B (1 << 1)
 #define SEGMENT_C (1 << 2)
@@ -53,13 +69,48 @@ typedef void (*digits_turn_off_t)(void);
 typedef void (*segments_update_t)(uint8_t);
 typedef void (*digits_turn_on_t)(uint8_t);
 
-//! Estructura que representa el driver del display
+//! Puntero a función que envía un cuadro completo al controlador externo de la pantalla
+typedef void (*frame_flush_t)(const uint8_t * frame, uint8_t digits);
+
+/**
+ * @brief Estructura que representa el driver del display
+ *
+ * Un driver multiplexado implementa `DigitsTurnOff`, `SegmentsUpdate` y `DigitsTurnOn`. Un driver para un
+ * controlador externo (por ejemplo un MAX7219 por SPI) implementa solamente `FrameFlush`, y el display le envía el
+ * cuadro completo únicamente cuando este cambia.
+ */
 typedef struct display_driver_s {
     digits_turn_off_t DigitsTurnOff;
     segments_update_t SegmentsUpdate;
     digits_turn_on_t DigitsTurnOn;
+    frame_flush_t FrameFlush;
 } const * display_driver_t;
 
+/**
+ * @brief Animación precalculada de segmentos
+ *
+ * Los cuadros se toman de `segments`, un byte por dígito empezando por el de la izquierda, y cada cuadro comienza
+ * `stride` bytes después del anterior. Con `stride` igual a `width` cada cuadro es independiente; con `stride` igual a
+ * 1 los cuadros son ventanas sucesivas de un texto que se desplaza, que debe tener `frames + width - 1` bytes. Los
+ * dígitos de la pantalla que quedan después de los `width` de cada cuadro se muestran apagados.
+ */
+typedef struct display_animation_s {
+    const uint8_t * segments;   //!< Segmentos codificados de todos los cuadros
+    const uint16_t * durations; //!< Duración de cada cuadro en barridos, NULL para usar `duration` en todos
+    uint16_t duration;          //!< Duración de los cuadros en barridos cuando `durations` es NULL
+    uint16_t frames;            //!< Cantidad de cuadros
+    uint8_t width;              //!< Dígitos de cada cuadro, se leen solamente los que entran en la pantalla
+    uint8_t stride;             //!< Bytes entre el comienzo de un cuadro y el siguiente
+    bool loop;                  //!< Vuelve al primer cuadro al terminar en lugar de finalizar
+} const * display_animation_t;
+
+/**
+ * @brief Función que se llama cuando termina una animación
+ *
+ * Se llama desde DisplayRefresh, por lo que no debe bloquearse ni volver a tomar el acceso a la pantalla.
+ */
+typedef void (*display_animation_done_t)(display_t display, void * context);
+
 /* === Public variable declarations ================================================================================ */
 
 /* === Public function declarations ================================================================================ */
@@ -72,9 +123,19 @@ typedef struct display_driver_s {
  */
 display_t DisplayCreate(uint8_t digits, display_driver_t driver);
 
+/**
+ * @brief Devuelve la cantidad de dígitos del display
+ *
+ * @param self Referencia al display
+ * @return uint8_t Cantidad de dígitos, 0 si la referencia no es válida
+ */
+uint8_t DisplayDigits(display_t self);
+
 /**
  * @brief Escribe en el display
  *
+ * Cada valor es un número del 0 al 9, DISPLAY_BLANK o DISPLAY_DASH. Cualquier otro valor deja el dígito apagado.
+ *
  * @param self Referencia al display
  * @param value Valores que se escribirán en la pantalla
  * @param size Cantidad de pantallas en el display
@@ -83,12 +144,59 @@ void DisplayWrite(display_t self, uint8_t value[], uint8_t size);
 /**
  * @brief Refresca la pantalla
  *
+ * Con un driver multiplexado enciende el siguiente dígito. Con un driver de cuadros completos solamente avanza el
+ * parpadeo y llama a DisplayFlush al terminar cada barrido.
+ *
  * @param self Referencia al display
  */
 void DisplayRefresh(display_t self);
+/**
+ * @brief Envía el cuadro actual al driver si cambió desde el último envío
+ *
+ * @param self Referencia al display
+ * @return int Devuelve -1 si hubo algún error, 1 si se envió un cuadro nuevo y 0 si no hubo cambios
+ */
+int DisplayFlush(display_t self);
+/**
+ * @brief Apaga la pantalla hasta el próximo refresco
+ *
+ * @param self Referencia al display
+ */
+void DisplayTurnOff(display_t self);
+/**
+ * @brief Indica cuánto avanzan los efectos de parpadeo en cada barrido
+ *
+ * Cuando se refresca la pantalla más lento que lo normal los efectos deben avanzar más de un paso por barrido para
+ * mantener su duración.
+ *
+ * @param self Referencia al display
+ * @param step Cantidad de pasos por barrido, al menos 1
+ * @return int Devuelve -1 si hubo algún error y 0 si no hubieron errores
+ */
+int DisplaySetSweepStep(display_t self, uint8_t step);
+/**
+ * @brief Avanza los efectos y la animación varios barridos de una vez y envía el cuadro si cambió
+ *
+ * Reemplaza a DisplayRefresh cuando un driver de cuadros completos mantiene la imagen y la pantalla solamente se
+ * actualiza al despertar.
+ *
+ * @param self Referencia al display
+ * @param sweeps Barridos transcurridos desde la llamada anterior, puede ser 0
+ * @return int Devuelve -1 si hubo algún error o el driver es multiplexado, 1 si se envió un cuadro nuevo y 0 si no
+ */
+int DisplayAdvance(display_t self, uint16_t sweeps);
+/**
+ * @brief Calcula cuántos barridos faltan para que un parpadeo o una animación cambien lo que se ve
+ *
+ * @param self Referencia al display
+ * @return uint16_t Barridos hasta el próximo cambio, DISPLAY_NO_CHANGE si no hay efectos ni animaciones
+ */
+uint16_t DisplaySweepsToChange(display_t self);
 /**
  * @brief Hace parpadear los digitos
  *
+ * Los dígitos fuera del rango dejan de parpadear.
+ *
  * @param self Referencia al display
  * @param from Desde que digito debe parpadear
  * @param to Hasta que digito se quiere que parpadee
@@ -99,12 +207,40 @@ int DisplayFlashDigits(display_t self, uint8_t from, uint8_t to, uint16_t time_o
 /**
  * @brief Hace parpadear los puntos
  *
+ * Los puntos fuera de la máscara dejan de parpadear.
+ *
  * @param self Referencia al display
  * @param mask Mascara que indica cuales son los puntos que se quieren prender
  * @param time_on Cantidad de veces que se quiere que el punto este prendido
  * @return int Devuelve -1 si hubo algún error y 0 si no hubieron errores
  */
 int DisplayFlashPoint(display_t self, uint8_t mask, uint16_t time_on);
+/**
+ * @brief Asigna un efecto de parpadeo a un dígito
+ *
+ * El dígito se apaga en la primera mitad de cada ciclo y se enciende en la segunda. Los dígitos con el mismo período
+ * y fase comparten el efecto y parpadean sincronizados.
+ *
+ * @param self Referencia al display
+ * @param digit Dígito al que se le asigna el efecto
+ * @param period Duración del ciclo en barridos de la pantalla, 0 para que quede fijo
+ * @param phase Desplazamiento del ciclo en barridos, menor que el período
+ * @return int Devuelve -1 si hubo algún error o no quedan efectos libres y 0 si no hubieron errores
+ */
+int DisplaySetDigitEffect(display_t self, uint8_t digit, uint16_t period, uint16_t phase);
+/**
+ * @brief Asigna un efecto de parpadeo al punto de un dígito
+ *
+ * El punto se enciende en la segunda mitad de cada ciclo. Mientras tenga un efecto se ignora lo fijado con
+ * DisplaySetPoint, que vuelve a valer al asignarle período 0.
+ *
+ * @param self Referencia al display
+ * @param digit Dígito cuyo punto recibe el efecto
+ * @param period Duración del ciclo en barridos de la pantalla, 0 para que quede fijo
+ * @param phase Desplazamiento del ciclo en barridos, menor que el período
+ * @return int Devuelve -1 si hubo algún error o no quedan efectos libres y 0 si no hubieron errores
+ */
+int DisplaySetPointEffect(display_t self, uint8_t digit, uint16_t period, uint16_t phase);
 /**
  * @brief Setea en 0 o 1 el punto
  *
@@ -114,6 +250,33 @@ int DisplayFlashPoint(display_t self, uint8_t mask, uint16_t time_on);
  * @return int int Devuelve -1 si hubo algún error y 0 si no hubieron errores
  */
 int DisplaySetPoint(display_t self, uint8_t digit, bool on);
+/**
+ * @brief Reproduce una animación precalculada
+ *
+ * Mientras dura la animación se muestran sus cuadros en lugar del valor escrito, los efectos y los puntos. Los
+ * cuadros avanzan en cada barrido de DisplayRefresh sin intervención de otras tareas. Si ya había una animación se
+ * reemplaza sin avisar que terminó.
+ *
+ * @param self Referencia al display
+ * @param animation Animación a reproducir, debe existir mientras se reproduce
+ * @param done Función que se llama al terminar, puede ser NULL
+ * @param context Argumento que recibe la función al terminar
+ * @return int Devuelve -1 si hubo algún error y 0 si no hubieron errores
+ */
+int DisplayPlay(display_t self, display_animation_t animation, display_animation_done_t done, void * context);
+/**
+ * @brief Detiene la animación en curso sin llamar a la función de finalización
+ *
+ * @param self Referencia al display
+ */
+void DisplayStop(display_t self);
+/**
+ * @brief Indica si hay una animación en curso
+ *
+ * @param self Referencia al display
+ * @return true Si se está reproduciendo una animación
+ */
+bool DisplayIsPlaying(display_t self);
 
 /* === End of conditional blocks =================================================================================== */
 
@@ -0,0 +1,182 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, María Ayelén Vega Caro <ayelenvegacaro@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef DISPLAY_SCAN_H_
+#define DISPLAY_SCAN_H_
+
+/** @file display_scan.h
+ ** @brief Declaraciones del planificador de la frecuencia de barrido de la pantalla
+ **
+ ** Elige el período de refresco más largo que no produce parpadeo visible para la cantidad de dígitos y el brillo, lo
+ ** reduce o apaga la pantalla después de un tiempo de inactividad, y vuelve a la frecuencia completa ante cualquier
+ ** actividad. También cuenta cuántas veces por segundo se despierta la tarea de refresco.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+#include <stdint.h>
+#include <stdbool.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+#define DISPLAY_SCAN_BRIGHTNESS_LEVELS 4          ///< Cantidad de niveles de brillo
+#define DISPLAY_SCAN_NO_DEADLINE       UINT32_MAX ///< El estado no cambia por inactividad
+
+#define DISPLAY_SCAN_RAM (sizeof(void *) + 6 * sizeof(uint32_t)) ///< RAM estática del planificador en bytes como máximo
+
+/* === Public data type declarations =============================================================================== */
+//! Estados del planificador
+typedef enum {
+    DISPLAY_SCAN_ACTIVE, ///< Frecuencia completa sin parpadeo
+    DISPLAY_SCAN_IDLE,   ///< Frecuencia reducida por inactividad
+    DISPLAY_SCAN_BLANK,  ///< Pantalla apagada por inactividad
+} display_scan_state_t;
+
+//! Configuración del planificador
+typedef struct display_scan_config_s {
+    uint16_t flicker_free_hz[DISPLAY_SCAN_BRIGHTNESS_LEVELS]; //!< Barridos por segundo mínimos para cada brillo
+    uint8_t idle_divider;                                     //!< Cuántas veces se alarga el período en reposo
+    uint32_t idle_timeout_ms;  //!< Inactividad hasta reducir la frecuencia, 0 para no reducirla
+    uint32_t blank_timeout_ms; //!< Inactividad hasta apagar la pantalla, 0 para no apagarla
+    uint16_t blank_period_ms;  //!< Período de despertar con la pantalla apagada
+} const * display_scan_config_t;
+
+//! Estructura que representa el planificador
+typedef struct display_scan_s * display_scan_t;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+/**
+ * @brief Crea el planificador de barrido
+ *
+ * @param config Configuración del planificador
+ * @param digits Cantidad de dígitos de la pantalla
+ * @param brightness Nivel de brillo inicial
+ * @return display_scan_t Referencia al planificador creado
+ */
+display_scan_t DisplayScanCreate(display_scan_config_t config, uint8_t digits, uint8_t brightness);
+
+/**
+ * @brief Cambia el nivel de brillo y recalcula el período de refresco
+ *
+ * @param self Referencia al planificador
+ * @param brightness Nivel de brillo, menor a DISPLAY_SCAN_BRIGHTNESS_LEVELS
+ * @return int Devuelve -1 si hubo algún error y 0 si no hubieron errores
+ */
+int DisplayScanSetBrightness(display_scan_t self, uint8_t brightness);
+
+/**
+ * @brief Informa que hubo actividad, reinicia la inactividad y vuelve a la frecuencia completa
+ *
+ * @param self Referencia al planificador
+ */
+void DisplayScanActivity(display_scan_t self);
+
+/**
+ * @brief Informa el tiempo transcurrido desde el último despertar
+ *
+ * Se llama una vez por cada despertar de la tarea de refresco.
+ *
+ * @param self Referencia al planificador
+ * @param elapsed_ms Milisegundos transcurridos desde la llamada anterior
+ * @return display_scan_state_t Estado en el que debe funcionar la pantalla hasta el próximo despertar
+ */
+display_scan_state_t DisplayScanElapsed(display_scan_t self, uint32_t elapsed_ms);
+
+/**
+ * @brief Devuelve el estado actual del planificador
+ *
+ * @param self Referencia al planificador
+ */
+display_scan_state_t DisplayScanState(display_scan_t self);
+
+/**
+ * @brief Devuelve el tiempo hasta el próximo despertar de la tarea de refresco
+ *
+ * @param self Referencia al planificador
+ * @return uint16_t Período en milisegundos
+ */
+uint16_t DisplayScanPeriod(display_scan_t self);
+
+/**
+ * @brief Devuelve la frecuencia con la que se enciende cada dígito a frecuencia completa
+ *
+ * El período se ajusta a la cantidad de dígitos, así que con más dígitos cada uno se enciende menos tiempo pero con la
+ * misma frecuencia. Si ni siquiera con un período de 1 ms se alcanza la frecuencia sin parpadeo el valor devuelto es
+ * menor que el configurado.
+ *
+ * @param self Referencia al planificador
+ * @return uint16_t Barridos por segundo
+ */
+uint16_t DisplayScanRefreshRate(display_scan_t self);
+
+/**
+ * @brief Devuelve cuántos barridos a frecuencia completa equivale cada barrido en el estado actual
+ *
+ * Sirve para que los efectos de parpadeo mantengan su duración cuando baja la frecuencia.
+ *
+ * @param self Referencia al planificador
+ */
+uint8_t DisplayScanSweepStep(display_scan_t self);
+
+/**
+ * @brief Convierte un tiempo a barridos de la pantalla a frecuencia completa
+ *
+ * @param self Referencia al planificador
+ * @param ms Tiempo en milisegundos
+ * @return uint16_t Cantidad de barridos, al menos 1
+ */
+uint16_t DisplayScanMsToSweeps(display_scan_t self, uint32_t ms);
+
+/**
+ * @brief Convierte barridos a frecuencia completa a milisegundos
+ *
+ * @param self Referencia al planificador
+ * @param sweeps Cantidad de barridos
+ * @return uint32_t Tiempo en milisegundos
+ */
+uint32_t DisplayScanSweepsToMs(display_scan_t self, uint32_t sweeps);
+
+/**
+ * @brief Devuelve el tiempo que falta para que la inactividad reduzca la frecuencia o apague la pantalla
+ *
+ * @param self Referencia al planificador
+ * @return uint32_t Milisegundos hasta el próximo cambio de estado, DISPLAY_SCAN_NO_DEADLINE si no hay ninguno
+ */
+uint32_t DisplayScanMsToNextState(display_scan_t self);
+
+/**
+ * @brief Devuelve la cantidad de despertares de la tarea de refresco en el último segundo completo
+ *
+ * @param self Referencia al planificador
+ */
+uint16_t DisplayScanWakeupsPerSecond(display_scan_t self);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DISPLAY_SCAN_H_ */
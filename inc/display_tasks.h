@@ -27,10 +27,11 @@ SPDX-License-Identifier: MIT
 /* === Headers files inclusions ==================================================================================== */
 #include "FreeRTOS.h"
 #include "task.h"
-#include "semphr.h"
-#include "event_groups.h"
+#include "active.h"
 #include "bsp.h"
 #include "clock.h"
+#include "display_scan.h"
+#include "scan_monitor.h"
 /* === Header for C++ compatibility ================================================================================ */
 
 #ifdef __cplusplus
@@ -38,32 +39,49 @@ extern "C" {
 #endif
 
 /* === Public macros definitions =================================================================================== */
-#define REFRESH_STACK_SIZE (2 * configMINIMAL_STACK_SIZE)
-#define TICKS_EVENTS_6     (1 << 6) // Evento para controlar paso de medio segundo
-#define TICKS_EVENTS_7     (1 << 7) // Evento para detectar tiempo de inactividad
-#define TICKS_EVENTS_8     (1 << 8) // evento para reiniciar contador de inactividad
 
 /* === Public data type declarations =============================================================================== */
 /**
- * @brief Estructura con los argumentos que se deben pasar a las tareas realacionadas con el refresco de pantalla
+ * @brief Estructura con los argumentos que se deben pasar al objeto activo del refresco de pantalla
  *
  */
 typedef struct refresh_task_args_s {
-    SemaphoreHandle_t display_mutex;
-    EventGroupHandle_t clock_events;
+    active_timer_t scan_timer; //!< Temporizador periódico del refresco
+    active_timer_t inactivity; //!< Temporizador de inactividad, que vuelve a arrancar con cada actividad
     board_t board;
     clock_t clock;
+    display_scan_t scan;
+    scan_monitor_t monitor;     //!< Monitor de los vencimientos del barrido, NULL para no supervisarlo
+    scan_monitor_level_t level; //!< Nivel de sobrecarga con el que se está barriendo
+    uint16_t period;     //!< Período con el que está corriendo el temporizador, 0 si se planificó un solo despertar
+    uint32_t last_tick;  //!< Momento del refresco anterior
+    uint32_t pending_ms; //!< Tiempo dormido que todavía no completa un barrido de los efectos
 } * refresh_task_args_t;
 
 /* === Public variable declarations ================================================================================ */
 
 /* === Public function declarations ================================================================================ */
 /**
- * @brief Tarea para refrescar la pantalla
+ * @brief Objeto activo que refresca la pantalla
  *
- * @param args
+ * Recibe INPUT_SCAN con el período que indica el planificador de barrido y cuenta los milisegundos transcurridos para
+ * el planificador. No lleva la hora: de eso se encarga TimekeeperHandler, así que una demora del refresco no atrasa el
+ * reloj. La actividad le llega como INPUT_ACTIVITY desde el reloj y arranca el temporizador de inactividad, que avisa
+ * directamente al reloj.
+ *
+ * Cada barrido periódico pasa por el monitor de vencimientos. Si la sobrecarga se sostiene baja a la frecuencia sin
+ * parpadeo más lenta, y si aun así no cede deja de alimentar el watchdog para que reinicie, cuando SCAN_WATCHDOG está
+ * habilitado.
+ *
+ * Con el MAX7219, que mantiene la imagen solo, nunca refresca periódicamente sino que se despierta una sola vez en el
+ * próximo parpadeo, cuadro de animación o cambio de estado por inactividad, con cada actividad y cuando el reloj le
+ * reenvía INPUT_CLOCK_CHANGED con la hora nueva ya dibujada. Con LOW_POWER_MODE hace lo mismo mientras la pantalla
+ * multiplexada está apagada.
+ *
+ * @param event Evento recibido
+ * @param context Argumentos del objeto
  */
-void RefreshDisplay(void * args);
+void RefreshHandler(const input_event_t * event, void * context);
 
 /* === End of conditional blocks =================================================================================== */
 
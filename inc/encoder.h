@@ -0,0 +1,122 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, María Ayelén Vega Caro <ayelenvegacaro@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef ENCODER_H_
+#define ENCODER_H_
+
+/** @file encoder.h
+ ** @brief Declaraciones del módulo que decodifica un encoder rotativo en la interrupción de sus pines
+ **
+ ** Cada flanco de los canales A y B interrumpe, y la interrupción busca el estado anterior y el nuevo en una tabla de
+ ** 16 transiciones: avanza, retrocede, no se movió o se perdió un flanco. Los rebotes van y vuelven entre dos estados
+ ** vecinos, así que se cancelan solos sin filtrar. Al completar un paso se escala según el tiempo desde el paso
+ ** anterior, para que girar rápido recorra más valores, y se suma a un contador que la tarea lee sin deshabilitar
+ ** interrupciones.
+ **
+ ** El módulo no depende del hardware, así que en el host los estados de los pines se inyectan con un simulador.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+#include <stdint.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+#define ENCODER_CHANNEL_A (1 << 1) ///< Bit del canal A en el estado de los pines
+#define ENCODER_CHANNEL_B (1 << 0) ///< Bit del canal B en el estado de los pines
+
+#define ENCODER_RAM (3 * sizeof(void *) + 8 * sizeof(uint32_t)) ///< RAM estática del encoder en bytes como máximo
+
+/* === Public data type declarations =============================================================================== */
+//! Configuración de la decodificación
+typedef struct encoder_config_s {
+    uint8_t transitions;   //!< Transiciones de cada paso: 4, 2 o 1 según cuántas tenga el encoder entre retenes
+    uint16_t medium_ms;    //!< Tiempo entre pasos por debajo del cual se multiplican por medium_scale
+    uint16_t fast_ms;      //!< Tiempo entre pasos por debajo del cual se multiplican por fast_scale
+    uint8_t medium_scale;  //!< Valores que avanza cada paso a velocidad media
+    uint8_t fast_scale;    //!< Valores que avanza cada paso a velocidad alta
+} const * encoder_config_t;
+
+//! Función que avisa a la tarea que hay pasos nuevos, se llama desde la interrupción
+typedef void (*encoder_notify_t)(void * context);
+
+//! Estructura que representa el encoder
+typedef struct encoder_s * encoder_t;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+/**
+ * @brief Crea el encoder
+ *
+ * @param state Estado inicial de los pines, con ENCODER_CHANNEL_A y ENCODER_CHANNEL_B
+ * @return encoder_t Referencia al encoder creado
+ */
+encoder_t EncoderCreate(uint8_t state);
+
+/**
+ * @brief Configura la decodificación y la función que despierta a la tarea que lee los pasos
+ *
+ * @param self Referencia al encoder
+ * @param config Configuración de la decodificación
+ * @param notify Función que avisa que hay pasos nuevos
+ * @param context Argumento de la función de aviso
+ * @return int Devuelve -1 si hubo algún error y 0 si no hubieron errores
+ */
+int EncoderStart(encoder_t self, encoder_config_t config, encoder_notify_t notify, void * context);
+
+/**
+ * @brief Decodifica un flanco de cualquiera de los dos canales, se llama desde la interrupción del pin
+ *
+ * Las interrupciones de los dos canales deben tener la misma prioridad, así ninguna interrumpe a la otra.
+ *
+ * @param self Referencia al encoder
+ * @param state Estado de los pines leído en la interrupción, con ENCODER_CHANNEL_A y ENCODER_CHANNEL_B
+ * @param timestamp Momento del flanco en milisegundos
+ */
+void EncoderEdgeFromIsr(encoder_t self, uint8_t state, uint32_t timestamp);
+
+/**
+ * @brief Devuelve los pasos ya escalados desde la última llamada
+ *
+ * @param self Referencia al encoder
+ * @return int32_t Pasos en sentido horario menos pasos en sentido antihorario
+ */
+int32_t EncoderTake(encoder_t self);
+
+/**
+ * @brief Devuelve la cantidad de transiciones inválidas, en las que cambiaron los dos canales entre dos lecturas
+ *
+ * Cada una indica que la interrupción no alcanzó a leer un flanco y se perdió parte de un paso.
+ *
+ * @param self Referencia al encoder
+ */
+uint16_t EncoderErrors(encoder_t self);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ENCODER_H_ */
@@ -0,0 +1,133 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, María Ayelén Vega Caro <ayelenvegacaro@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef GESTURE_H_
+#define GESTURE_H_
+
+/** @file gesture.h
+ ** @brief Declaraciones del reconocedor de gestos de las teclas
+ **
+ ** Recibe las pulsaciones y liberaciones ya filtradas de cada tecla y las convierte en gestos: pulsación corta,
+ ** pulsación larga, doble pulsación, acorde de dos teclas y repetición con período decreciente mientras la tecla sigue
+ ** presionada. Qué gestos reconoce cada tecla y todos sus tiempos salen de una única tabla de configuración.
+ **
+ ** Una tecla que solamente tiene pulsación corta, con o sin repetición, la informa apenas se presiona. Las que además
+ ** pueden formar un acorde, tener pulsación larga o doble pulsación la informan cuando se descartan esos gestos.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+#include <stdint.h>
+#include <stdbool.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+#define GESTURE_MAX_KEYS    32         ///< Cantidad máxima de teclas, una por bit de las máscaras de configuración
+#define GESTURE_NO_DEADLINE UINT32_MAX ///< Valor de GestureProcess cuando no hay que despertarse por tiempo
+
+//! RAM estática del reconocedor en bytes como máximo, casi toda en el estado de cada tecla
+#define GESTURE_RAM (2 * sizeof(void *) + GESTURE_MAX_KEYS * (4 * sizeof(uint32_t) + 2 * sizeof(uint16_t)))
+
+/* === Public data type declarations =============================================================================== */
+//! Gestos que se reconocen
+typedef enum {
+    GESTURE_PRESS,  ///< Pulsación corta
+    GESTURE_LONG,   ///< La tecla lleva presionada su tiempo de pulsación larga
+    GESTURE_DOUBLE, ///< Dos pulsaciones cortas seguidas
+    GESTURE_REPEAT, ///< Repetición de una tecla que sigue presionada
+    GESTURE_CHORD,  ///< Dos teclas presionadas casi al mismo tiempo
+} gesture_kind_t;
+
+//! Gesto reconocido
+typedef struct gesture_event_s {
+    gesture_kind_t kind;
+    uint8_t key;        //!< Tecla del gesto, la primera que se presionó en un acorde
+    uint8_t other;      //!< Segunda tecla de un acorde
+    uint16_t count;     //!< Número de repetición, empezando en 1
+    uint32_t timestamp; //!< Momento del gesto en milisegundos
+} const * gesture_event_t;
+
+//! Tabla con los gestos de cada tecla y sus tiempos
+typedef struct gesture_config_s {
+    uint16_t long_ms[GESTURE_MAX_KEYS]; //!< Tiempo de pulsación larga de cada tecla, 0 si no tiene
+    uint32_t double_keys;               //!< Teclas con doble pulsación, un bit por tecla
+    uint32_t chord_keys;                //!< Teclas que pueden formar acordes entre sí
+    uint32_t repeat_keys;               //!< Teclas que se repiten mientras siguen presionadas
+    uint16_t double_ms;                 //!< Tiempo máximo entre soltar y volver a presionar en una doble pulsación
+    uint16_t chord_ms;                  //!< Tiempo máximo entre las pulsaciones de las dos teclas de un acorde
+    uint16_t repeat_delay_ms;           //!< Tiempo presionada hasta la primera repetición
+    uint16_t repeat_start_ms;           //!< Período entre la primera y la segunda repetición
+    uint16_t repeat_min_ms;             //!< Período mínimo de repetición
+    uint8_t repeat_accel;               //!< Porcentaje en que se acorta el período después de cada repetición
+} const * gesture_config_t;
+
+//! Función que recibe los gestos reconocidos
+typedef void (*gesture_handler_t)(gesture_event_t event, void * context);
+
+//! Estructura que representa el reconocedor
+typedef struct gesture_s * gesture_t;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+/**
+ * @brief Crea el reconocedor de gestos
+ *
+ * @param config Tabla con los gestos y tiempos
+ * @param keys Cantidad de teclas, como máximo GESTURE_MAX_KEYS
+ * @return gesture_t Referencia al reconocedor creado
+ */
+gesture_t GestureCreate(gesture_config_t config, uint8_t keys);
+
+/**
+ * @brief Informa que una tecla se presionó o se soltó
+ *
+ * @param self Referencia al reconocedor
+ * @param key Número de tecla
+ * @param pressed Indica si la tecla se presionó o se soltó
+ * @param timestamp Momento del cambio en milisegundos
+ * @param handler Función que recibe los gestos
+ * @param context Argumento de la función
+ */
+void GestureKey(gesture_t self, uint8_t key, bool pressed, uint32_t timestamp, gesture_handler_t handler,
+                void * context);
+
+/**
+ * @brief Informa los gestos que dependen del paso del tiempo
+ *
+ * @param self Referencia al reconocedor
+ * @param now Tiempo actual en milisegundos
+ * @param handler Función que recibe los gestos
+ * @param context Argumento de la función
+ * @return uint32_t Milisegundos hasta que se debe volver a procesar aunque no cambien las teclas, o
+ * GESTURE_NO_DEADLINE
+ */
+uint32_t GestureProcess(gesture_t self, uint32_t now, gesture_handler_t handler, void * context);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GESTURE_H_ */
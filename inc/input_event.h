@@ -0,0 +1,87 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, María Ayelén Vega Caro <ayelenvegacaro@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef INPUT_EVENT_H_
+#define INPUT_EVENT_H_
+
+/** @file input_event.h
+ ** @brief Declaraciones de los eventos que reciben los objetos activos
+ **
+ ** Cada evento indica quién lo generó, qué pasó y en qué momento, así que llegan uno por uno y en orden en lugar de
+ ** juntarse en bits que se pisan entre sí.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+#include <stdint.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+/* === Public data type declarations =============================================================================== */
+//! Origen de un evento
+typedef enum {
+    INPUT_SOURCE_KEY,     ///< Teclas, el código es el número de tecla
+    INPUT_SOURCE_TIMER,   ///< Tiempos que mide el objeto de refresco y temporizadores de los objetos activos
+    INPUT_SOURCE_DISPLAY, ///< Pantalla
+    INPUT_SOURCE_ENCODER, ///< Encoder rotativo, el código es la tecla que reemplaza
+} input_source_t;
+
+//! Qué indica un evento, cada valor pertenece a un solo origen
+typedef enum {
+    INPUT_KEY_PRESSED,       ///< Pulsación corta de una tecla
+    INPUT_KEY_LONG_PRESSED,  ///< Se cumplió el tiempo de pulsación larga de una tecla
+    INPUT_KEY_DOUBLE,        ///< Doble pulsación de una tecla
+    INPUT_KEY_REPEAT,        ///< Repetición de una tecla que sigue presionada
+    INPUT_KEY_CHORD,         ///< Dos teclas presionadas juntas, la segunda en el campo other
+    INPUT_TIMER_INACTIVITY,  ///< Pasó el tiempo máximo sin actividad
+    INPUT_ANIMATION_DONE,    ///< Terminó una animación de la pantalla
+    INPUT_ENCODER_STEPS,     ///< Pasos del encoder en un sentido, la cantidad en el campo other
+    INPUT_KEY_POLL,          ///< Hay que atender el teclado y el encoder, por una interrupción o un tiempo vencido
+    INPUT_SCAN,              ///< Toca refrescar la pantalla
+    INPUT_ACTIVITY,          ///< Hubo actividad del usuario, el origen es el del evento que la causó
+    INPUT_CLOCK_CHANGED,     ///< Cambió la hora o la alarma, los CLOCK_CHANGED_* en el campo other
+    INPUT_CLOCK_SYNC,        ///< Toca llevar la hora al contador de ticks y planificar el próximo cambio
+    INPUT_KINDS,             ///< Cantidad de tipos de eventos
+} input_kind_t;
+
+//! Evento con su origen, tipo y momento
+typedef struct input_event_s {
+    uint32_t timestamp; //!< Momento del evento en milisegundos
+    uint8_t source;     //!< Origen del evento, uno de input_source_t
+    uint8_t kind;       //!< Tipo de evento, uno de input_kind_t
+    uint8_t code;       //!< Dato del evento, el número de tecla para las teclas
+    uint8_t other;      //!< Segunda tecla de un acorde o cantidad de pasos del encoder
+} input_event_t;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INPUT_EVENT_H_ */
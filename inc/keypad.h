@@ -0,0 +1,173 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, María Ayelén Vega Caro <ayelenvegacaro@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef KEYPAD_H_
+#define KEYPAD_H_
+
+/** @file keypad.h
+ ** @brief Declaraciones del módulo que procesa las teclas despertado por las interrupciones de sus pines
+ **
+ ** Las interrupciones de los pines guardan cada flanco con su marca de tiempo en una cola circular y avisan a una
+ ** única tarea. Mientras haya teclas cambiando la tarea lee todas las teclas juntas en una palabra de 32 bits cada
+ ** período de muestreo y las filtra con contadores verticales: unas pocas operaciones sobre la palabra completa
+ ** eliminan los rebotes de hasta 32 entradas a la vez, así que el costo del muestreo no depende de la cantidad de
+ ** teclas. Cuando todas están estables vuelve a dormir hasta el próximo flanco o pulsación larga.
+ **
+ ** El módulo no depende del hardware, así que en el host los flancos se inyectan con un controlador de interrupciones
+ ** simulado.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+#include <stdint.h>
+#include <stdbool.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+#define KEYPAD_MAX_KEYS        32         ///< Cantidad máxima de teclas, una por bit de la palabra leída
+#define KEYPAD_QUEUE_SIZE      16         ///< Flancos que se pueden guardar sin procesar, debe ser potencia de 2
+#define KEYPAD_NO_DEADLINE     UINT32_MAX ///< Valor de KeypadProcess cuando no hay que despertarse por tiempo
+#define KEYPAD_DEBOUNCE_SAMPLES 4         ///< Muestras iguales seguidas para aceptar un cambio de una tecla
+
+//! RAM estática del teclado en bytes como máximo: tablas y tiempos de cada tecla y la cola de flancos
+#define KEYPAD_RAM                                                                                                     \
+    (5 * sizeof(void *) + sizeof(keypad_debounce_t) + KEYPAD_MAX_KEYS * (2 + 2 * sizeof(uint32_t)) +                   \
+     KEYPAD_QUEUE_SIZE * 2 * sizeof(uint32_t) + 7 * sizeof(uint32_t))
+
+/* === Public data type declarations =============================================================================== */
+//! Acciones que informa el procesamiento de las teclas
+typedef enum {
+    KEYPAD_PRESSED,      ///< La tecla se presionó y dejó de rebotar
+    KEYPAD_RELEASED,     ///< La tecla se soltó y dejó de rebotar
+    KEYPAD_LONG_PRESSED, ///< La tecla lleva presionada el tiempo de pulsación larga
+} keypad_action_t;
+
+//! Configuración del procesamiento de las teclas
+typedef struct keypad_config_s {
+    uint16_t scan_ms;                        //!< Período de muestreo mientras hay teclas cambiando
+    uint16_t long_press_ms[KEYPAD_MAX_KEYS]; //!< Tiempo de pulsación larga de cada tecla, 0 si no tiene
+} const * keypad_config_t;
+
+//! Función que lee todas las teclas juntas, con un bit en 1 por cada tecla presionada
+typedef uint32_t (*keypad_read_t)(void);
+
+//! Función que avisa a la tarea que hay flancos nuevos, se llama desde la interrupción
+typedef void (*keypad_notify_t)(void * context);
+
+//! Función que recibe las acciones de las teclas, se llama desde KeypadProcess
+typedef void (*keypad_handler_t)(uint8_t key, keypad_action_t action, uint32_t timestamp, void * context);
+
+//! Contadores verticales de dos bits, el bit n de cada palabra pertenece a la entrada n
+typedef struct keypad_debounce_s {
+    uint32_t state;  //!< Estado estable de cada entrada
+    uint32_t count0; //!< Bit menos significativo del contador de cada entrada
+    uint32_t count1; //!< Bit más significativo del contador de cada entrada
+} keypad_debounce_t;
+
+//! Estructura que representa el teclado
+typedef struct keypad_s * keypad_t;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+/**
+ * @brief Filtra una muestra de hasta 32 entradas con contadores verticales
+ *
+ * Una entrada cambia de estado cuando la muestra difiere del estado estable KEYPAD_DEBOUNCE_SAMPLES veces seguidas.
+ *
+ * @param self Contadores y estado de las entradas
+ * @param sample Muestra con un bit por entrada
+ * @return uint32_t Entradas que cambiaron de estado en esta muestra
+ */
+uint32_t KeypadDebounce(keypad_debounce_t * self, uint32_t sample);
+
+/**
+ * @brief Crea el teclado
+ *
+ * @param bits Bit de la palabra leída que corresponde a cada tecla
+ * @param keys Cantidad de teclas, como máximo KEYPAD_MAX_KEYS
+ * @param read Función que lee todas las teclas juntas
+ * @return keypad_t Referencia al teclado creado
+ */
+keypad_t KeypadCreate(const uint8_t * bits, uint8_t keys, keypad_read_t read);
+
+/**
+ * @brief Configura el procesamiento y la función que despierta a la tarea que procesa las teclas
+ *
+ * Los flancos que llegan antes se guardan igual y se procesan en el primer aviso.
+ *
+ * @param self Referencia al teclado
+ * @param config Configuración del procesamiento
+ * @param notify Función que avisa que hay flancos nuevos
+ * @param context Argumento de la función de aviso
+ * @return int Devuelve -1 si hubo algún error y 0 si no hubieron errores
+ */
+int KeypadStart(keypad_t self, keypad_config_t config, keypad_notify_t notify, void * context);
+
+/**
+ * @brief Guarda un flanco de una tecla, se llama desde la interrupción del pin
+ *
+ * Las interrupciones de todas las teclas deben tener la misma prioridad, así ninguna interrumpe a otra mientras
+ * escribe en la cola.
+ *
+ * @param self Referencia al teclado
+ * @param key Número de tecla
+ * @param timestamp Momento del flanco en milisegundos
+ */
+void KeypadEdgeFromIsr(keypad_t self, uint8_t key, uint32_t timestamp);
+
+/**
+ * @brief Procesa los flancos guardados, muestrea las teclas si corresponde y revisa las pulsaciones largas
+ *
+ * Las pulsaciones y liberaciones se informan con el momento del primer flanco que las inició.
+ *
+ * @param self Referencia al teclado
+ * @param now Tiempo actual en milisegundos
+ * @param handler Función que recibe las acciones
+ * @param context Argumento de la función
+ * @return uint32_t Milisegundos hasta que se debe volver a procesar aunque no haya flancos, o KEYPAD_NO_DEADLINE
+ */
+uint32_t KeypadProcess(keypad_t self, uint32_t now, keypad_handler_t handler, void * context);
+
+/**
+ * @brief Indica si una tecla está presionada, según el último estado estable
+ *
+ * @param self Referencia al teclado
+ * @param key Número de tecla
+ */
+bool KeypadIsPressed(keypad_t self, uint8_t key);
+
+/**
+ * @brief Devuelve la cantidad de flancos perdidos porque la cola estaba llena
+ *
+ * @param self Referencia al teclado
+ */
+uint16_t KeypadOverruns(keypad_t self);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* KEYPAD_H_ */
@@ -0,0 +1,80 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, María Ayelén Vega Caro <ayelenvegacaro@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef MAX7219_H_
+#define MAX7219_H_
+
+/** @file max7219.h
+ ** @brief Declaraciones del driver de display para controladores MAX7219 conectados por SPI
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+#include <stdint.h>
+#include "display.h"
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+#define MAX7219_REG_DIGIT_0      0x01 ///< Registro del primer dígito, los siguientes son consecutivos
+#define MAX7219_REG_DECODE_MODE  0x09
+#define MAX7219_REG_INTENSITY    0x0A
+#define MAX7219_REG_SCAN_LIMIT   0x0B
+#define MAX7219_REG_SHUTDOWN     0x0C
+#define MAX7219_REG_DISPLAY_TEST 0x0F
+
+#define MAX7219_RAM sizeof(void *) ///< RAM estática del driver en bytes, la referencia al puerto SPI
+
+/* === Public data type declarations =============================================================================== */
+/**
+ * @brief Puntero a una función que envía palabras de 16 bits por SPI
+ *
+ * Cada palabra es una escritura de registro del MAX7219 (dirección en el byte alto, dato en el byte bajo). La función
+ * debe poder enviar todas las palabras sin esperar a que terminen de salir, por ejemplo cargándolas en la FIFO del SPI.
+ */
+typedef void (*max7219_transfer_t)(const uint16_t * words, uint8_t count);
+
+//! Estructura que representa el puerto SPI usado por el driver
+typedef struct max7219_spi_s {
+    max7219_transfer_t Transfer;
+} const * max7219_spi_t;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+/**
+ * @brief Inicializa el MAX7219 y crea el driver de display asociado
+ *
+ * @param spi Puerto SPI por el que se comunica el controlador
+ * @param digits Cantidad de dígitos conectados al controlador
+ * @param intensity Brillo de la pantalla, entre 0 y 15
+ * @return display_driver_t Driver para usar con DisplayCreate
+ */
+display_driver_t Max7219DriverCreate(max7219_spi_t spi, uint8_t digits, uint8_t intensity);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MAX7219_H_ */
@@ -0,0 +1,111 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, María Ayelén Vega Caro <ayelenvegacaro@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef POWER_H_
+#define POWER_H_
+
+/** @file power.h
+ ** @brief Declaraciones de la planificación del bajo consumo
+ **
+ ** Cuando la pantalla está apagada o la mantiene un controlador externo no hace falta despertar para refrescarla, así
+ ** que el procesador puede dormir hasta el próximo momento en que cambie algo: la alarma, un parpadeo, un cambio de
+ ** estado por inactividad o la hora que se muestra. El módulo elige el más cercano de esos vencimientos y cuenta
+ ** cuántas veces y cuánto tiempo se durmió, tanto en el equipo como en las pruebas, donde el sueño se simula.
+ **
+ ** El módulo no depende del sistema operativo: quien lo use mide el tiempo dormido y lo informa.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+#include <stdint.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+#define POWER_NO_DEADLINE UINT32_MAX ///< No hay vencimiento previsto
+
+#define POWER_RAM (sizeof(uint64_t) + sizeof(power_stats_t)) ///< RAM estática del módulo en bytes como máximo
+
+/* === Public data type declarations =============================================================================== */
+//! Vencimientos que pueden despertar al procesador
+typedef enum {
+    POWER_DEADLINE_ALARM,      ///< Momento en que empieza a sonar la alarma
+    POWER_DEADLINE_BLINK,      ///< Próximo cambio de un parpadeo o de una animación
+    POWER_DEADLINE_INACTIVITY, ///< Próximo cambio de estado de la pantalla por inactividad
+    POWER_DEADLINE_ROLLOVER,   ///< Próximo cambio de la hora que se muestra
+    POWER_DEADLINES,           ///< Cantidad de vencimientos
+} power_deadline_t;
+
+//! Estadísticas del bajo consumo
+typedef struct power_stats_s {
+    uint32_t plans;                    //!< Veces que se planificó cuánto dormir
+    uint32_t reasons[POWER_DEADLINES]; //!< Veces que cada vencimiento fue el más cercano
+    uint32_t sleeps;                   //!< Veces que se durmió, que son también los despertares
+    uint32_t early;                    //!< Despertares antes de lo previsto, por una interrupción
+    uint32_t slept_ms;                 //!< Tiempo total dormido en milisegundos
+    uint32_t longest_ms;               //!< Sueño más largo en milisegundos
+} power_stats_t;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+/**
+ * @brief Elige cuánto se puede dormir hasta el vencimiento más cercano
+ *
+ * @param deadlines Milisegundos hasta cada vencimiento, POWER_NO_DEADLINE si no hay
+ * @return uint32_t Milisegundos a dormir, al menos 1, o POWER_NO_DEADLINE si no hay ningún vencimiento
+ */
+uint32_t PowerPlanSleep(const uint32_t deadlines[POWER_DEADLINES]);
+
+/**
+ * @brief Informa que el procesador se va a dormir
+ *
+ * @param expected_ms Tiempo previsto hasta el próximo vencimiento, POWER_NO_DEADLINE si no hay
+ */
+void PowerSleepEnter(uint32_t expected_ms);
+
+/**
+ * @brief Informa que el procesador se despertó
+ *
+ * @param slept_ms Tiempo que realmente durmió
+ */
+void PowerSleepExit(uint32_t slept_ms);
+
+/**
+ * @brief Devuelve las estadísticas acumuladas
+ *
+ * @param stats Estadísticas
+ */
+void PowerGetStats(power_stats_t * stats);
+
+/**
+ * @brief Borra las estadísticas acumuladas
+ */
+void PowerResetStats(void);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* POWER_H_ */
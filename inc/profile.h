@@ -0,0 +1,137 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, María Ayelén Vega Caro <ayelenvegacaro@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef PROFILE_H_
+#define PROFILE_H_
+
+/** @file profile.h
+ ** @brief Declaraciones del perfilador de los caminos críticos
+ **
+ ** Cada sonda mide lo que tarda un tramo de código entre PROFILE_BEGIN y PROFILE_END con el contador de ciclos DWT
+ ** CYCCNT del Cortex-M4, o con un reloj monótono en nanosegundos cuando corre en la computadora. Las duraciones se
+ ** acumulan en un histograma de tamaño fijo con una cubeta por potencia de dos, junto con el mínimo, el máximo y el
+ ** promedio, que se consultan desde el código o con el depurador.
+ **
+ ** Con PROFILE en cero las macros no generan código y el módulo queda vacío. Las sondas no son reentrantes: se usan
+ ** solamente desde la tarea de los objetos activos.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+#include "config.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+#define PROFILE_BUCKETS 24 ///< Cubetas del histograma, la última cuenta también todas las duraciones mayores
+
+//! RAM estática de las sondas en bytes como máximo, solamente se reserva con PROFILE
+#define PROFILE_RAM (PROFILE_PROBES * (4 * sizeof(uint32_t) + sizeof(uint64_t) + PROFILE_BUCKETS * sizeof(uint32_t)))
+
+#if PROFILE
+#if defined(__ARM_ARCH)
+#define PROFILE_NOW() (*(volatile uint32_t *)0xE0001004) ///< Registro DWT CYCCNT, un ciclo por cuenta
+#else
+#define PROFILE_NOW() ProfileHostNow() ///< Reloj monótono de la computadora, un nanosegundo por cuenta
+#endif
+//! Arranca el contador y borra las mediciones
+#define PROFILE_INIT()       ProfileInit()
+//! Marca el comienzo del tramo que mide la sonda, en el mismo bloque que su PROFILE_END
+#define PROFILE_BEGIN(probe) const uint32_t profile_##probe = PROFILE_NOW()
+//! Marca el final del tramo y acumula lo que tardó
+#define PROFILE_END(probe)   ProfileRecord((probe), PROFILE_NOW() - profile_##probe)
+#else
+#define PROFILE_INIT()
+#define PROFILE_BEGIN(probe)
+#define PROFILE_END(probe)
+#endif
+
+/* === Public data type declarations =============================================================================== */
+//! Tramos de código que se miden
+typedef enum {
+    PROFILE_DISPLAY_REFRESH, ///< Barrido de un dígito de la pantalla
+    PROFILE_CLOCK_SYNC,      ///< Avance de la hora hasta el contador de ticks
+    PROFILE_CHANGE_MODE,     ///< Cambio de modo del reloj
+    PROFILE_INPUT,           ///< Lectura de las teclas, los gestos y el encoder
+    PROFILE_PROBES,          ///< Cantidad de sondas
+} profile_probe_t;
+
+//! Mediciones de una sonda
+typedef struct profile_stats_s {
+    uint32_t count;                    //!< Veces que se midió el tramo
+    uint32_t min;                      //!< Duración más corta
+    uint32_t max;                      //!< Duración más larga
+    uint32_t mean;                     //!< Duración promedio
+    uint32_t buckets[PROFILE_BUCKETS]; //!< Cubeta i: duraciones entre 2^i y 2^(i+1) - 1, la 0 incluye las nulas
+} profile_stats_t;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+#if PROFILE
+/**
+ * @brief Arranca el contador de ciclos y borra las mediciones
+ */
+void ProfileInit(void);
+
+/**
+ * @brief Acumula una duración en una sonda
+ *
+ * @param probe Sonda
+ * @param counts Duración en cuentas del contador
+ */
+void ProfileRecord(profile_probe_t probe, uint32_t counts);
+
+/**
+ * @brief Devuelve las mediciones de una sonda
+ *
+ * @param probe Sonda
+ * @param stats Mediciones
+ * @return true La sonda existe
+ * @return false La sonda no existe
+ */
+bool ProfileGetStats(profile_probe_t probe, profile_stats_t * stats);
+
+/**
+ * @brief Borra las mediciones de todas las sondas
+ */
+void ProfileReset(void);
+
+#if !defined(__ARM_ARCH)
+/**
+ * @brief Lee el reloj monótono de la computadora
+ *
+ * @return uint32_t Nanosegundos, que dan la vuelta cada 4 segundos
+ */
+uint32_t ProfileHostNow(void);
+#endif
+#endif
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PROFILE_H_ */
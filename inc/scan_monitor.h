@@ -0,0 +1,128 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, María Ayelén Vega Caro <ayelenvegacaro@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef SCAN_MONITOR_H_
+#define SCAN_MONITOR_H_
+
+/** @file scan_monitor.h
+ ** @brief Declaraciones del monitor de los vencimientos del barrido de la pantalla
+ **
+ ** Cada barrido llega con el momento en que debía atenderse. El monitor mide el período real entre barridos, guarda
+ ** el atraso en un histograma con una cubeta por potencia de dos y cuenta los vencimientos perdidos, que el núcleo
+ ** saltea y se ven como parpadeo. Los barridos se agrupan en ventanas, y si la sobrecarga se sostiene durante varias
+ ** ventanas seguidas el nivel sube: primero se registra, después se degradan los efectos y por último se pide
+ ** reiniciar con el watchdog. Una ventana sin sobrecarga vuelve al nivel normal, salvo que ya se haya pedido el
+ ** reinicio.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+#include <stdbool.h>
+#include <stdint.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+#define SCAN_MONITOR_BUCKETS 8 ///< Cubetas del atraso: 0 ms, 1 ms, 2 a 3 ms, ..., y la última desde 64 ms
+
+//! RAM estática del monitor en bytes como máximo, la mayor parte en sus estadísticas
+#define SCAN_MONITOR_RAM (sizeof(void *) + 3 * sizeof(uint32_t) + sizeof(scan_monitor_stats_t))
+
+/* === Public data type declarations =============================================================================== */
+//! Niveles de la respuesta a la sobrecarga
+typedef enum {
+    SCAN_MONITOR_OK,      ///< Sin sobrecarga sostenida
+    SCAN_MONITOR_LOG,     ///< Hubo una ventana sobrecargada, solamente se registra
+    SCAN_MONITOR_DEGRADE, ///< La sobrecarga se sostiene, hay que aliviar el barrido
+    SCAN_MONITOR_RESET,   ///< La sobrecarga no cede, hay que reiniciar
+} scan_monitor_level_t;
+
+//! Configuración del monitor
+typedef struct scan_monitor_config_s {
+    uint16_t window;         //!< Barridos de cada ventana
+    uint16_t overrun_misses; //!< Vencimientos perdidos en una ventana para considerarla sobrecargada
+    uint8_t degrade_windows; //!< Ventanas sobrecargadas seguidas para degradar los efectos
+    uint8_t reset_windows;   //!< Ventanas sobrecargadas seguidas para reiniciar
+} const * scan_monitor_config_t;
+
+//! Contadores del monitor, para el diagnóstico en el campo
+typedef struct scan_monitor_stats_s {
+    uint32_t scans;                      //!< Barridos atendidos
+    uint32_t missed;                     //!< Vencimientos perdidos
+    uint32_t late[SCAN_MONITOR_BUCKETS]; //!< Barridos según su atraso en ms
+    uint16_t period_min;                 //!< Período real más corto entre dos barridos seguidos
+    uint16_t period_max;                 //!< Período real más largo entre dos barridos seguidos
+    uint32_t overrun_windows;            //!< Ventanas sobrecargadas
+    uint8_t streak;                      //!< Ventanas sobrecargadas seguidas hasta ahora
+    scan_monitor_level_t level;          //!< Nivel actual
+    scan_monitor_level_t worst;          //!< Nivel más alto al que se llegó
+} scan_monitor_stats_t;
+
+//! Estructura que representa el monitor
+typedef struct scan_monitor_s * scan_monitor_t;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+/**
+ * @brief Crea el monitor del barrido
+ *
+ * @param config Configuración del monitor
+ * @return scan_monitor_t Referencia al monitor creado, o NULL si la configuración no es válida
+ */
+scan_monitor_t ScanMonitorCreate(scan_monitor_config_t config);
+
+/**
+ * @brief Registra un barrido
+ *
+ * @param self Monitor
+ * @param now Momento en que se atiende el barrido, en ms
+ * @param deadline Momento en que debía atenderse, en ms
+ * @param period Período previsto entre barridos, en ms
+ * @return scan_monitor_level_t Nivel después de este barrido
+ */
+scan_monitor_level_t ScanMonitorScan(scan_monitor_t self, uint32_t now, uint32_t deadline, uint16_t period);
+
+/**
+ * @brief Olvida el barrido anterior, para no medir el período a través de un cambio de período o una pausa
+ *
+ * @param self Monitor
+ */
+void ScanMonitorRestart(scan_monitor_t self);
+
+/**
+ * @brief Devuelve los contadores del monitor
+ *
+ * @param self Monitor
+ * @param stats Contadores
+ * @return true Se copiaron los contadores
+ * @return false El monitor o los contadores no son válidos
+ */
+bool ScanMonitorGetStats(scan_monitor_t self, scan_monitor_stats_t * stats);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SCAN_MONITOR_H_ */
@@ -0,0 +1,131 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, María Ayelén Vega Caro <ayelenvegacaro@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef STATS_H_
+#define STATS_H_
+
+/** @file stats.h
+ ** @brief Declaraciones de las estadísticas de ejecución del sistema operativo
+ **
+ ** Cada muestra trae el tiempo de ejecución acumulado de cada tarea, medido por el sistema operativo con un
+ ** temporizador de hardware, la menor cantidad de pila libre que tuvo y el heap libre. El porcentaje de uso del
+ ** procesador se calcula con la diferencia entre dos muestras, así que no importa que el contador de tiempo dé la
+ ** vuelta, y queda en una foto que se consulta desde el código o con el depurador, o se vuelca como texto.
+ **
+ ** El módulo no depende del sistema operativo: quien lo use lee las tareas y le pasa los valores.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+#include <stddef.h>
+#include <stdint.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+#define STATS_MAX_TASKS 4 ///< Tareas que se siguen, las que sobran se cuentan pero no se muestran
+
+#define STATS_RAM (2 * sizeof(uint32_t) + sizeof(stats_snapshot_t)) ///< RAM estática del módulo en bytes como máximo
+
+/* === Public data type declarations =============================================================================== */
+//! Valores de una tarea leídos del sistema operativo
+typedef struct stats_sample_s {
+    uint32_t id;         //!< Número que identifica a la tarea, que no cambia aunque cambie el orden de la lista
+    const char * name;   //!< Nombre de la tarea
+    uint32_t runtime;    //!< Tiempo de ejecución acumulado en cuentas del temporizador
+    uint16_t stack_free; //!< Menor cantidad de palabras de pila que quedaron libres
+} stats_sample_t;
+
+//! Estadísticas de una tarea
+typedef struct stats_task_s {
+    uint32_t id;         //!< Número que identifica a la tarea
+    const char * name;   //!< Nombre de la tarea
+    uint32_t runtime;    //!< Tiempo de ejecución acumulado en la última muestra
+    uint16_t cpu;        //!< Uso del procesador entre las dos últimas muestras, en décimas de por ciento
+    uint16_t stack_free; //!< Menor cantidad de palabras de pila que quedaron libres
+} stats_task_t;
+
+//! Foto de las estadísticas en la última muestra
+typedef struct stats_snapshot_s {
+    uint32_t samples;                    //!< Muestras tomadas
+    uint32_t elapsed;                    //!< Cuentas del temporizador entre las dos últimas muestras
+    uint8_t count;                       //!< Tareas guardadas en la foto
+    uint8_t dropped;                     //!< Tareas que no entraron en la foto
+    stats_task_t tasks[STATS_MAX_TASKS]; //!< Tareas en el orden en que aparecieron
+    size_t heap_free;                    //!< Bytes libres del heap
+    size_t heap_min;                     //!< Menor cantidad de bytes libres que tuvo el heap
+    uint32_t overhead;                   //!< Cuentas del temporizador que tardó la última muestra
+    uint32_t overhead_max;               //!< Mayor cantidad de cuentas que tardó una muestra
+} stats_snapshot_t;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+/**
+ * @brief Toma una muestra de las tareas y el heap
+ *
+ * En la primera muestra de cada tarea todavía no hay con qué comparar, así que su uso del procesador queda en cero.
+ *
+ * @param tasks Valores de cada tarea
+ * @param count Cantidad de tareas
+ * @param total Tiempo total acumulado en cuentas del temporizador
+ * @param heap_free Bytes libres del heap
+ * @param heap_min Menor cantidad de bytes libres que tuvo el heap
+ */
+void StatsSample(const stats_sample_t tasks[], uint8_t count, uint32_t total, size_t heap_free, size_t heap_min);
+
+/**
+ * @brief Informa cuánto tardó en tomarse la última muestra
+ *
+ * @param counts Cuentas del temporizador que tardó la muestra, incluida la lectura de las tareas
+ */
+void StatsSampleCost(uint32_t counts);
+
+/**
+ * @brief Devuelve la foto de la última muestra
+ *
+ * @param snapshot Foto de las estadísticas
+ */
+void StatsGetSnapshot(stats_snapshot_t * snapshot);
+
+/**
+ * @brief Vuelca una foto como texto, una línea por tarea
+ *
+ * @param snapshot Foto de las estadísticas
+ * @param buffer Texto terminado en cero, que se corta si no entra
+ * @param size Tamaño del texto en bytes
+ * @return size_t Caracteres escritos sin contar el cero final
+ */
+size_t StatsFormat(const stats_snapshot_t * snapshot, char * buffer, size_t size);
+
+/**
+ * @brief Borra las estadísticas y olvida las muestras anteriores
+ */
+void StatsReset(void);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STATS_H_ */
@@ -35,18 +35,8 @@ extern "C" {
 #endif
 
 /* === Public macros definitions =================================================================================== */
-#define BUTTON_ACCEPT        BUTTON_EVENT_0
-#define BUTTON_CANCEL        BUTTON_EVENT_1
-#define BUTTON_INCREMENT     BUTTON_EVENT_2
-#define BUTTON_DECREMENT     BUTTON_EVENT_3
-#define BUTTON_SET_TIME      BUTTON_EVENT_4
-#define BUTTON_SET_ALARM     BUTTON_EVENT_5
-#define HALF_SECOND          TICKS_EVENTS_6
-#define INACTIVITY_TIME      TICKS_EVENTS_7
-#define RESET_THIRTY_SECONDS TICKS_EVENT_8
-
-#define DELAY_SET_TIME       3000 ///< Cantidad de tiempo que tiene que presionarse el boton de setear tiempo en ms
-#define DELAY_SET_ALARM      3000 ///< Cantidad de tiempo que tiene que presionarse el boton de setear alarma en ms
+#define DELAY_SET_TIME  3000 ///< Cantidad de tiempo que tiene que presionarse el boton de setear tiempo en ms
+#define DELAY_SET_ALARM 3000 ///< Cantidad de tiempo que tiene que presionarse el boton de setear alarma en ms
 
 /* === Public data type declarations =============================================================================== */
 
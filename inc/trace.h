@@ -0,0 +1,148 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, María Ayelén Vega Caro <ayelenvegacaro@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef TRACE_H_
+#define TRACE_H_
+
+/** @file trace.h
+ ** @brief Declaraciones del registro de eventos del núcleo para armar una línea de tiempo
+ **
+ ** Los cambios de tarea, las notificaciones desde interrupciones, el sueño sin tick y los eventos que se encolan y
+ ** atienden en los objetos activos se guardan como registros binarios de 8 bytes en un anillo en RAM, que conserva
+ ** los últimos TRACE_RECORDS. El anillo se vuelca con el depurador, por ejemplo con `dump binary value trace.bin
+ ** trace` en gdb, y `make trace` lo convierte al formato JSON de Chrome trace, que se abre en Perfetto. La espera
+ ** entre que se encola un evento y se atiende se ve como una flecha y como el largo de la cola de cada objeto.
+ **
+ ** Con TRACE en cero las macros no generan código. Escribir un registro tarda unas decenas de ciclos y se puede hacer
+ ** desde interrupciones.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+#include "config.h"
+#include <stdint.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+#define TRACE_MAGIC       0x31435254 ///< "TRC1", para reconocer un volcado del anillo
+#define TRACE_RECORDS     256        ///< Registros del anillo, una potencia de dos
+#define TRACE_NAMES       8          ///< Nombres de tareas y de objetos activos que se guardan
+#define TRACE_NAME_LENGTH 12         ///< Largo máximo de cada nombre, con el cero final
+
+#define TRACE_RAM (sizeof(trace_buffer_t) + sizeof(trace_clock_t)) ///< RAM estática del anillo y de su reloj en bytes
+
+#if TRACE
+//! Guarda un registro en el anillo
+#define TRACE_RECORD(kind, id, arg) TraceRecord((kind), (id), (arg))
+#else
+#define TRACE_RECORD(kind, id, arg)
+#endif
+
+/* === Public data type declarations =============================================================================== */
+//! Función que devuelve el tiempo actual en cuentas de un contador libre
+typedef uint32_t (*trace_clock_t)(void);
+
+//! Tipos de registro
+typedef enum {
+    TRACE_TASK_IN = 1,  ///< Entra a correr la tarea id
+    TRACE_TASK_OUT,     ///< Deja de correr la tarea id
+    TRACE_NOTIFY_ISR,   ///< Una interrupción notificó a una tarea
+    TRACE_SLEEP_BEGIN,  ///< El procesador se duerme sin tick, arg son los ticks previstos
+    TRACE_SLEEP_END,    ///< El procesador se despierta
+    TRACE_ACTIVE_POST,  ///< Se encoló un evento en el objeto id, arg es el origen por 256 más el tipo
+    TRACE_ACTIVE_DROP,  ///< La cola del objeto id estaba llena y se perdió el evento
+    TRACE_ACTIVE_BEGIN, ///< El objeto id empieza a atender un evento, arg es el tipo
+    TRACE_ACTIVE_END,   ///< El objeto id terminó de atender el evento
+    TRACE_SCAN_LEVEL,   ///< Cambió el nivel de sobrecarga del barrido de la pantalla, arg es el nivel nuevo
+} trace_kind_t;
+
+//! Registro del anillo
+typedef struct trace_record_s {
+    uint32_t timestamp; //!< Momento en cuentas del contador libre
+    uint8_t kind;       //!< Tipo de registro
+    uint8_t id;         //!< Número de tarea o prioridad del objeto activo
+    uint16_t arg;       //!< Dato que depende del tipo
+} trace_record_t;
+
+//! Anillo tal como se vuelca, sin punteros para que se lea igual en la computadora
+typedef struct trace_buffer_s {
+    uint32_t magic;                               //!< TRACE_MAGIC una vez inicializado
+    uint32_t hz;                                  //!< Cuentas por segundo del contador libre
+    uint32_t written;                             //!< Registros escritos desde el arranque
+    char tasks[TRACE_NAMES][TRACE_NAME_LENGTH];   //!< Nombre de cada tarea por número
+    char objects[TRACE_NAMES][TRACE_NAME_LENGTH]; //!< Nombre de cada objeto activo por prioridad
+    trace_record_t records[TRACE_RECORDS];        //!< El registro n está en la posición n % TRACE_RECORDS
+} trace_buffer_t;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+/**
+ * @brief Borra el anillo y arranca a registrar
+ *
+ * @param clock Contador libre para las marcas de tiempo
+ * @param hz Cuentas por segundo del contador
+ */
+void TraceInit(trace_clock_t clock, uint32_t hz);
+
+/**
+ * @brief Guarda un registro en el anillo, pisando el más viejo si está lleno
+ *
+ * No hace nada hasta que se llama a TraceInit.
+ *
+ * @param kind Tipo de registro
+ * @param id Número de tarea o prioridad del objeto activo
+ * @param arg Dato que depende del tipo
+ */
+void TraceRecord(trace_kind_t kind, uint8_t id, uint16_t arg);
+
+/**
+ * @brief Guarda el nombre de una tarea
+ *
+ * @param id Número de la tarea
+ * @param name Nombre, que se corta si es muy largo
+ */
+void TraceTaskName(uint8_t id, const char * name);
+
+/**
+ * @brief Guarda el nombre de un objeto activo
+ *
+ * @param id Prioridad del objeto
+ * @param name Nombre, que se corta si es muy largo
+ */
+void TraceObjectName(uint8_t id, const char * name);
+
+/**
+ * @brief Devuelve el anillo
+ *
+ * @return const trace_buffer_t* Anillo con los últimos registros
+ */
+const trace_buffer_t * TraceGetBuffer(void);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TRACE_H_ */
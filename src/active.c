@@ -0,0 +1,401 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, María Ayelén Vega Caro <ayelenvegacaro@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file  active.c
+ ** @brief Núcleo de objetos activos que comparten una sola tarea y una sola pila
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+#include "active.h"
+#include "trace.h"
+#include <stddef.h>
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+#define WHEEL_SHIFT 5                  ///< Cada nivel de la rueda tiene 2^WHEEL_SHIFT ranuras
+#define WHEEL_SLOTS (1 << WHEEL_SHIFT) ///< Ranuras de cada nivel, una por bit del mapa de ocupación
+#define WHEEL_MASK  (WHEEL_SLOTS - 1)
+
+_Static_assert(WHEEL_SLOTS == 32, "El mapa de ocupación de cada nivel es un uint32_t");
+
+/* === Private data type declarations ============================================================================== */
+//! Estructura que define a un objeto activo
+struct active_s {
+    uint8_t priority;
+    active_handler_t handler;
+    void * context;
+    active_slot_t * queue;
+    uint8_t length;
+    uint8_t head;  //!< Próximo evento a atender
+    uint8_t count; //!< Eventos pendientes
+    active_stats_t stats;
+};
+
+//! Estructura que define a un temporizador
+struct active_timer_s {
+    active_timer_t next; //!< Siguiente temporizador de la misma ranura
+    active_timer_t prev; //!< Anterior temporizador de la misma ranura
+    uint8_t level;       //!< Nivel de la rueda donde está
+    uint8_t slot;        //!< Ranura del nivel donde está
+    active_t target;
+    input_event_t event;
+    bool running;
+    uint32_t deadline;
+    uint32_t period;
+};
+
+//! Estado del núcleo
+struct active_kernel_s {
+    active_clock_t clock;
+    struct active_s objects[ACTIVE_MAX_OBJECTS];
+    active_t ready[ACTIVE_MAX_OBJECTS]; //!< Objetos ordenados de mayor a menor prioridad
+    uint8_t count;
+    struct active_timer_s timers[ACTIVE_MAX_TIMERS];
+    uint8_t timer_count;
+    active_timer_t wheel[ACTIVE_WHEEL_LEVELS][WHEEL_SLOTS]; //!< Temporizadores corriendo, en listas por ranura
+    uint32_t occupied[ACTIVE_WHEEL_LEVELS];                 //!< Un bit por cada ranura con temporizadores
+    uint32_t wheel_time;                                    //!< Hasta dónde avanzó la rueda
+    uint32_t runs;
+};
+
+_Static_assert(sizeof(struct active_kernel_s) <= ACTIVE_RAM, "ACTIVE_RAM no alcanza para el núcleo");
+
+/* === Private function declarations =============================================================================== */
+/**
+ * @brief Indica si ya se llegó a un momento, teniendo en cuenta el desborde del contador de tiempo
+ *
+ * @param now Tiempo actual
+ * @param deadline Momento buscado
+ */
+static bool ActiveReached(uint32_t now, uint32_t deadline);
+
+/**
+ * @brief Agrega un temporizador a la ranura que corresponde a su vencimiento
+ *
+ * Va al nivel más bajo donde el vencimiento está a menos de una vuelta de la rueda, así las ranuras de cada nivel
+ * quedan ordenadas por tiempo. Si está más lejos que lo que cubre el último nivel queda en su última ranura y se
+ * vuelve a ubicar cuando la rueda llega a ella.
+ *
+ * @param timer Temporizador a agregar
+ */
+static void WheelInsert(active_timer_t timer);
+
+/**
+ * @brief Quita un temporizador de su ranura
+ *
+ * @param timer Temporizador a quitar
+ */
+static void WheelRemove(active_timer_t timer);
+
+/**
+ * @brief Busca la próxima ranura ocupada de un nivel
+ *
+ * @param level Nivel de la rueda
+ * @param time Momento en que la rueda llega a la ranura encontrada
+ * @return active_timer_t Primer temporizador de la ranura, o NULL si el nivel está vacío
+ */
+static active_timer_t WheelNext(uint8_t level, uint32_t * time);
+
+/**
+ * @brief Avanza la rueda hasta el tiempo actual, encolando los temporizadores vencidos y bajando de nivel los que
+ * se acercan
+ *
+ * Solamente visita las ranuras ocupadas, así que no hay trabajo por cada milisegundo ni por los temporizadores que
+ * todavía no vencen.
+ *
+ * @param now Tiempo actual
+ * @return uint32_t Tiempo exacto hasta el próximo vencimiento, o ACTIVE_NO_DEADLINE
+ */
+static uint32_t ActiveExpire(uint32_t now);
+
+/* === Private variable definitions ================================================================================ */
+static struct active_kernel_s kernel;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+static bool ActiveReached(uint32_t now, uint32_t deadline) {
+    return (int32_t)(now - deadline) >= 0;
+}
+
+static void WheelInsert(active_timer_t timer) {
+    uint8_t level = 0;
+    uint8_t shift = 0;
+    uint32_t distance = 0;
+
+    if (!ActiveReached(kernel.wheel_time, timer->deadline)) {
+        for (level = 0; level < ACTIVE_WHEEL_LEVELS; level++) {
+            shift = level * WHEEL_SHIFT;
+            // La máscara corrige el desborde del contador de tiempo después de correr los bits
+            distance = ((timer->deadline >> shift) - (kernel.wheel_time >> shift)) & (UINT32_MAX >> shift);
+            if (distance < WHEEL_SLOTS) {
+                break;
+            }
+        }
+    }
+    if (level == ACTIVE_WHEEL_LEVELS) {
+        level--;
+        distance = WHEEL_SLOTS - 1;
+    }
+    timer->level = level;
+    timer->slot = ((kernel.wheel_time >> shift) + distance) & WHEEL_MASK;
+    timer->prev = NULL;
+    timer->next = kernel.wheel[level][timer->slot];
+    if (timer->next) {
+        timer->next->prev = timer;
+    }
+    kernel.wheel[level][timer->slot] = timer;
+    kernel.occupied[level] |= 1UL << timer->slot;
+}
+
+static void WheelRemove(active_timer_t timer) {
+    if (timer->prev) {
+        timer->prev->next = timer->next;
+    } else {
+        kernel.wheel[timer->level][timer->slot] = timer->next;
+    }
+    if (timer->next) {
+        timer->next->prev = timer->prev;
+    }
+    if (kernel.wheel[timer->level][timer->slot] == NULL) {
+        kernel.occupied[timer->level] &= ~(1UL << timer->slot);
+    }
+}
+
+static active_timer_t WheelNext(uint8_t level, uint32_t * time) {
+    uint8_t shift = level * WHEEL_SHIFT;
+    uint8_t cursor = (kernel.wheel_time >> shift) & WHEEL_MASK;
+    uint32_t ahead;
+    uint8_t distance;
+
+    if (kernel.occupied[level] == 0) {
+        return NULL;
+    }
+    // Se rota el mapa para que la ranura actual quede en el bit 0 y la próxima ocupada sea el primer bit en uno
+    ahead = (kernel.occupied[level] >> cursor) | (kernel.occupied[level] << ((WHEEL_SLOTS - cursor) & WHEEL_MASK));
+    distance = (uint8_t)__builtin_ctz(ahead);
+    *time = ((kernel.wheel_time >> shift) + distance) << shift;
+    return kernel.wheel[level][(cursor + distance) & WHEEL_MASK];
+}
+
+static uint32_t ActiveExpire(uint32_t now) {
+    active_timer_t timer;
+    active_timer_t list;
+    uint32_t time;
+    uint32_t best_time = 0;
+    uint32_t next = ACTIVE_NO_DEADLINE;
+    uint32_t occupied;
+    uint8_t best_level;
+    uint8_t level;
+
+    while (true) {
+        best_level = ACTIVE_WHEEL_LEVELS;
+        for (level = 0; level < ACTIVE_WHEEL_LEVELS; level++) {
+            if (WheelNext(level, &time) && (best_level == ACTIVE_WHEEL_LEVELS ||
+                                            time - kernel.wheel_time < best_time - kernel.wheel_time)) {
+                best_level = level;
+                best_time = time;
+            }
+        }
+        if (best_level == ACTIVE_WHEEL_LEVELS || !ActiveReached(now, best_time)) {
+            break;
+        }
+        kernel.wheel_time = best_time;
+        list = WheelNext(best_level, &time);
+        kernel.wheel[best_level][(best_time >> (best_level * WHEEL_SHIFT)) & WHEEL_MASK] = NULL;
+        kernel.occupied[best_level] &= ~(1UL << ((best_time >> (best_level * WHEEL_SHIFT)) & WHEEL_MASK));
+        while (list) {
+            timer = list;
+            list = list->next;
+            if (best_level > 0) {
+                WheelInsert(timer); // Se acercó su vencimiento, así que baja a un nivel más fino
+                continue;
+            }
+            timer->event.timestamp = timer->deadline;
+            ActivePost(timer->target, &timer->event);
+            if (timer->period == 0) {
+                timer->running = false;
+                continue;
+            }
+            // Si se atendió tarde se saltean los vencimientos perdidos, sin correr la fase
+            do {
+                timer->deadline += timer->period;
+            } while (ActiveReached(now, timer->deadline));
+            WheelInsert(timer);
+        }
+    }
+    kernel.wheel_time = now;
+
+    // La próxima ranura ocupada de cada nivel tiene los vencimientos más cercanos de ese nivel
+    for (level = 0; level < ACTIVE_WHEEL_LEVELS - 1; level++) {
+        for (timer = WheelNext(level, &time); timer; timer = timer->next) {
+            if (timer->deadline - now < next) {
+                next = timer->deadline - now;
+            }
+        }
+    }
+    // En el último nivel no, porque los temporizadores más lejanos que una vuelta esperan en la última ranura y los que
+    // se agregan después pueden vencer antes en una ranura siguiente, así que se revisan todas las ranuras ocupadas
+    for (occupied = kernel.occupied[ACTIVE_WHEEL_LEVELS - 1]; occupied; occupied &= occupied - 1) {
+        for (timer = kernel.wheel[ACTIVE_WHEEL_LEVELS - 1][__builtin_ctz(occupied)]; timer; timer = timer->next) {
+            if (timer->deadline - now < next) {
+                next = timer->deadline - now;
+            }
+        }
+    }
+    return next;
+}
+
+/* === Public function implementation ============================================================================== */
+void ActiveInit(active_clock_t clock) {
+    memset(&kernel, 0, sizeof(kernel));
+    kernel.clock = clock;
+    if (clock) {
+        kernel.wheel_time = clock();
+    }
+}
+
+active_t ActiveCreate(uint8_t priority, active_handler_t handler, void * context, active_slot_t * queue,
+                      uint8_t length) {
+    active_t self;
+    uint8_t index;
+
+    if (!kernel.clock || !handler || !queue || length == 0 || kernel.count == ACTIVE_MAX_OBJECTS) {
+        return NULL;
+    }
+    for (index = 0; index < kernel.count; index++) {
+        if (kernel.ready[index]->priority == priority) {
+            return NULL;
+        }
+    }
+    self = &kernel.objects[kernel.count];
+    self->priority = priority;
+    self->handler = handler;
+    self->context = context;
+    self->queue = queue;
+    self->length = length;
+
+    // Se inserta ordenado, así el núcleo recorre los objetos de mayor a menor prioridad
+    index = kernel.count;
+    while (index > 0 && kernel.ready[index - 1]->priority < priority) {
+        kernel.ready[index] = kernel.ready[index - 1];
+        index--;
+    }
+    kernel.ready[index] = self;
+    kernel.count++;
+    return self;
+}
+
+bool ActivePost(active_t self, const input_event_t * event) {
+    active_slot_t * slot;
+
+    if (!self || !event) {
+        return false;
+    }
+    if (self->count == self->length) {
+        self->stats.dropped++;
+        TRACE_RECORD(TRACE_ACTIVE_DROP, self->priority, (uint16_t)(event->source << 8 | event->kind));
+        return false;
+    }
+    TRACE_RECORD(TRACE_ACTIVE_POST, self->priority, (uint16_t)(event->source << 8 | event->kind));
+    slot = &self->queue[(self->head + self->count) % self->length];
+    slot->event = *event;
+    slot->posted_at = kernel.clock();
+    self->count++;
+    if (self->count > self->stats.high_water) {
+        self->stats.high_water = self->count;
+    }
+    return true;
+}
+
+active_timer_t ActiveTimerCreate(active_t target, const input_event_t * event) {
+    active_timer_t timer;
+
+    if (!target || !event || kernel.timer_count == ACTIVE_MAX_TIMERS) {
+        return NULL;
+    }
+    timer = &kernel.timers[kernel.timer_count++];
+    timer->target = target;
+    timer->event = *event;
+    timer->running = false;
+    return timer;
+}
+
+void ActiveTimerStart(active_timer_t timer, uint32_t delay, uint32_t period) {
+    if (timer) {
+        if (timer->running) {
+            WheelRemove(timer);
+        }
+        timer->deadline = kernel.clock() + delay;
+        timer->period = period;
+        timer->running = true;
+        WheelInsert(timer);
+    }
+}
+
+void ActiveTimerStop(active_timer_t timer) {
+    if (timer && timer->running) {
+        WheelRemove(timer);
+        timer->running = false;
+    }
+}
+
+uint32_t ActiveRun(void) {
+    active_t self;
+    active_slot_t slot;
+    uint32_t latency;
+    uint32_t next;
+    uint8_t index;
+
+    kernel.runs++;
+    while (true) {
+        // Antes de cada evento se revisan los temporizadores y se busca desde la mayor prioridad, por si el evento
+        // anterior encoló otros o tardó lo suficiente para que venza alguno
+        next = ActiveExpire(kernel.clock());
+        for (index = 0; index < kernel.count && kernel.ready[index]->count == 0; index++) {
+        }
+        if (index == kernel.count) {
+            return next;
+        }
+        self = kernel.ready[index];
+        slot = self->queue[self->head];
+        self->head = (self->head + 1) % self->length;
+        self->count--;
+        latency = kernel.clock() - slot.posted_at;
+        if (latency > self->stats.max_latency) {
+            self->stats.max_latency = latency;
+        }
+        self->stats.dispatched++;
+        TRACE_RECORD(TRACE_ACTIVE_BEGIN, self->priority, slot.event.kind);
+        self->handler(&slot.event, self->context);
+        TRACE_RECORD(TRACE_ACTIVE_END, self->priority, slot.event.kind);
+    }
+}
+
+void ActiveGetStats(active_t self, active_stats_t * stats) {
+    if (self && stats) {
+        *stats = self->stats;
+    }
+}
+
+uint32_t ActiveRuns(void) {
+    return kernel.runs;
+}
+
+/* === End of documentation ======================================================================================== */
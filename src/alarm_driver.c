@@ -23,11 +23,12 @@ SPDX-License-Identifier: MIT
 
 /* === Headers files inclusions =============================================================== */
 #include "alarm_driver.h"
+#include <stddef.h>
 
 /* === Macros definitions ====================================================================== */
 
 /* === Private data type declarations ========================================================== */
-static board_t board_local;
+static digital_output_group_t alarm_outputs; //!< Buzzer y leds, que cambian juntos
 
 /* === Private variable declarations =========================================================== */
 
@@ -50,17 +51,11 @@ static void AlarmDeactivate(void);
 
 /* === Private function implementation ========================================================= */
 static void AlarmActivate(void) {
-    DigitalOutputActivate(board_local->buzzer);
-    DigitalOutputActivate(board_local->led1);
-    DigitalOutputActivate(board_local->led2);
-    DigitalOutputActivate(board_local->led3);
+    DigitalOutputGroupActivate(alarm_outputs, DIGITAL_GROUP_ALL);
 }
 
 static void AlarmDeactivate(void) {
-    DigitalOutputDeactivate(board_local->buzzer);
-    DigitalOutputDeactivate(board_local->led1);
-    DigitalOutputDeactivate(board_local->led2);
-    DigitalOutputDeactivate(board_local->led3);
+    DigitalOutputGroupDeactivate(alarm_outputs, DIGITAL_GROUP_ALL);
 }
 
 /* === Public function implementation ========================================================= */
@@ -69,8 +64,10 @@ clock_alarm_driver_t AlarmDriverCreate(board_t board) {
         .AlarmActivate = AlarmActivate,
         .AlarmDeactivate = AlarmDeactivate,
     };
-    board_local = board;
-    return &driver;
+    const digital_output_t outputs[] = {board->buzzer, board->led1, board->led2, board->led3};
+
+    alarm_outputs = DigitalOutputGroupCreate(outputs, sizeof(outputs) / sizeof(outputs[0]));
+    return alarm_outputs ? &driver : NULL;
 }
 
 /* === End of documentation ==================================================================== */
@@ -28,10 +28,25 @@ SPDX-License-Identifier: MIT
 #include "ciaa.h"
 #include "poncho.h"
 #include "board.h"
-#include <stdlib.h>
+#include "config.h"
+#include "max7219.h"
+#include "FreeRTOS.h"
+#include "task.h"
 
 /* === Macros definitions ========================================================================================== */
 
+#if DIGITAL_OUTPUTS_POOL_SIZE < 4
+#error "DIGITAL_OUTPUTS_POOL_SIZE no alcanza para el buzzer y los tres leds de la placa"
+#endif
+#if DIGITAL_INPUTS_POOL_SIZE < BOARD_KEYS + 2 * BOARD_ENCODER
+#error "DIGITAL_INPUTS_POOL_SIZE no alcanza para las teclas y el encoder de la placa"
+#endif
+#if DIGITAL_GROUPS_POOL_SIZE < 1 + BOARD_ENCODER
+#error "DIGITAL_GROUPS_POOL_SIZE no alcanza para los grupos de teclas, del encoder y de salidas de la alarma"
+#endif
+
+#define ENCODER_CHANNEL 6 ///< Primer canal de interrupción de los pines del encoder, después de las teclas
+
 /* === Private data type declarations ============================================================================== */
 
 /* === Private function declarations =============================================================================== */
@@ -68,6 +83,62 @@ void DigitsTurnOn(uint8_t digit);
  */
 void SegmentUpdate(uint8_t value);
 
+/**
+ * @brief Configura las interrupciones por ambos flancos de los pines de las teclas
+ *
+ * @param self Referencia a la placa con las entradas de las teclas ya creadas
+ */
+static void KeypadInit(board_t self);
+
+/**
+ * @brief Atiende la interrupción del pin de una tecla
+ *
+ * @param channel Canal de interrupción, igual al número de tecla
+ */
+static void KeyIsr(uint8_t channel);
+
+/**
+ * @brief Lee todas las teclas juntas con una lectura por puerto
+ *
+ * @return uint32_t Un bit en 1 por cada tecla presionada, en el orden de BOARD_KEY_*
+ */
+static uint32_t KeypadRead(void);
+
+#if BOARD_ENCODER
+/**
+ * @brief Configura los pines del encoder y las interrupciones por ambos flancos de sus dos canales
+ *
+ * @param self Referencia a la placa
+ */
+static void EncoderInit(board_t self);
+
+/**
+ * @brief Atiende la interrupción de cualquiera de los dos canales del encoder
+ *
+ * @param channel Canal de interrupción
+ */
+static void EncoderIsr(uint8_t channel);
+#endif
+
+#if BOARD_DISPLAY_MAX7219
+/**
+ * @brief Inicializa el SSP1 como maestro SPI de 16 bits
+ *
+ */
+static void SpiInit(void);
+
+/**
+ * @brief Envía palabras de 16 bits por SPI cargándolas en la FIFO de transmisión del SSP
+ *
+ * Un cuadro completo del MAX7219 tiene como mucho DISPLAY_MAX_DIGITS palabras y entra en los 8 lugares de la FIFO, así
+ * que solo espera lugar cuando todavía se están enviando las palabras de la llamada anterior.
+ *
+ * @param words Palabras que se quieren enviar
+ * @param count Cantidad de palabras
+ */
+static void SpiTransfer(const uint16_t * words, uint8_t count);
+#endif
+
 /* === Private variable definitions ================================================================================ */
 static const struct display_driver_s display_driver = {
     .DigitsTurnOff = DigitsTurnOff,
@@ -75,6 +146,20 @@ static const struct display_driver_s display_driver = {
     .DigitsTurnOn = DigitsTurnOn,
 };
 
+static keypad_t keypad;
+static digital_input_group_t keys; //!< Entradas de las teclas en el orden de BOARD_KEY_*
+
+#if BOARD_ENCODER
+static encoder_t encoder;
+static digital_input_group_t encoder_pins; //!< Canales B y A, en los bits de ENCODER_CHANNEL_B y ENCODER_CHANNEL_A
+#endif
+
+#if BOARD_DISPLAY_MAX7219
+static const struct max7219_spi_s spi_port = {
+    .Transfer = SpiTransfer,
+};
+#endif
+
 /* === Public variable definitions ================================================================================= */
 
 /* === Private function definitions ================================================================================ */
@@ -184,21 +269,185 @@ void DigitsTurnOn(uint8_t digit) {
     Chip_GPIO_SetValue(LPC_GPIO_PORT, DIGITS_GPIO, (1 << (3 - digit)) & DIGITS_MASK);
 }
 
+static void KeypadInit(board_t self) {
+    uint8_t bits[BOARD_KEYS];
+    const digital_input_t inputs[BOARD_KEYS] = {
+        [BOARD_KEY_ACCEPT] = self->accept,       [BOARD_KEY_CANCEL] = self->cancel,
+        [BOARD_KEY_INCREMENT] = self->increment, [BOARD_KEY_DECREMENT] = self->decrement,
+        [BOARD_KEY_SET_TIME] = self->set_time,   [BOARD_KEY_SET_ALARM] = self->set_alarm,
+    };
+    static const struct {
+        uint8_t gpio;
+        uint8_t bit;
+    } pins[BOARD_KEYS] = {
+        [BOARD_KEY_ACCEPT] = {KEY_ACCEPT_GPIO, KEY_ACCEPT_BIT}, [BOARD_KEY_CANCEL] = {KEY_CANCEL_GPIO, KEY_CANCEL_BIT},
+        [BOARD_KEY_INCREMENT] = {KEY_F4_GPIO, KEY_F4_BIT},      [BOARD_KEY_DECREMENT] = {KEY_F3_GPIO, KEY_F3_BIT},
+        [BOARD_KEY_SET_TIME] = {KEY_F1_GPIO, KEY_F1_BIT},       [BOARD_KEY_SET_ALARM] = {KEY_F2_GPIO, KEY_F2_BIT},
+    };
+
+    keys = DigitalInputGroupCreate(inputs, BOARD_KEYS);
+    if (keys == NULL) {
+        self->keypad = NULL;
+        return;
+    }
+    // El grupo devuelve cada tecla en el bit de su posición en BOARD_KEY_*
+    for (uint8_t key = 0; key < BOARD_KEYS; key++) {
+        bits[key] = key;
+    }
+    keypad = KeypadCreate(bits, BOARD_KEYS, KeypadRead);
+    self->keypad = keypad;
+
+    for (uint8_t channel = 0; channel < BOARD_KEYS; channel++) {
+        Chip_SCU_GPIOIntPinSel(channel, pins[channel].gpio, pins[channel].bit);
+        Chip_PININT_ClearIntStatus(LPC_GPIO_PIN_INT, PININTCH(channel));
+        Chip_PININT_SetPinModeEdge(LPC_GPIO_PIN_INT, PININTCH(channel));
+        Chip_PININT_EnableIntLow(LPC_GPIO_PIN_INT, PININTCH(channel));
+        Chip_PININT_EnableIntHigh(LPC_GPIO_PIN_INT, PININTCH(channel));
+        // Todas con la misma prioridad, y por debajo de las que pueden llamar a funciones del sistema operativo
+        NVIC_SetPriority((IRQn_Type)(PIN_INT0_IRQn + channel), configLIBRARY_MAX_SYSCALL_INTERRUPT_PRIORITY + 1);
+        NVIC_ClearPendingIRQ((IRQn_Type)(PIN_INT0_IRQn + channel));
+        NVIC_EnableIRQ((IRQn_Type)(PIN_INT0_IRQn + channel));
+    }
+}
+
+static void KeyIsr(uint8_t channel) {
+    Chip_PININT_ClearIntStatus(LPC_GPIO_PIN_INT, PININTCH(channel));
+    // El nivel no se lee acá, la tarea muestrea todas las teclas juntas hasta que dejan de rebotar
+    KeypadEdgeFromIsr(keypad, channel, xTaskGetTickCountFromISR());
+}
+
+static uint32_t KeypadRead(void) {
+    return DIGITAL_GROUP_ACTIVE(DigitalInputGroupRead(keys));
+}
+
+void GPIO0_IRQHandler(void) {
+    KeyIsr(0);
+}
+
+void GPIO1_IRQHandler(void) {
+    KeyIsr(1);
+}
+
+void GPIO2_IRQHandler(void) {
+    KeyIsr(2);
+}
+
+void GPIO3_IRQHandler(void) {
+    KeyIsr(3);
+}
+
+void GPIO4_IRQHandler(void) {
+    KeyIsr(4);
+}
+
+void GPIO5_IRQHandler(void) {
+    KeyIsr(5);
+}
+
+#if BOARD_ENCODER
+static void EncoderInit(board_t self) {
+    digital_input_t inputs[2];
+
+    Chip_SCU_PinMuxSet(ENCODER_B_PORT, ENCODER_B_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_PULLUP | ENCODER_B_FUNC);
+    inputs[0] = DigitalInputCreate(ENCODER_B_GPIO, ENCODER_B_BIT, false);
+    Chip_SCU_PinMuxSet(ENCODER_A_PORT, ENCODER_A_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_PULLUP | ENCODER_A_FUNC);
+    inputs[1] = DigitalInputCreate(ENCODER_A_GPIO, ENCODER_A_BIT, false);
+
+    // Los dos canales están en el mismo puerto, así que una sola lectura los toma en el mismo instante
+    encoder_pins = DigitalInputGroupCreate(inputs, 2);
+    if (encoder_pins == NULL) {
+        // El encoder es opcional, sin sus entradas el reloj se maneja solamente con las teclas
+        self->encoder = NULL;
+        return;
+    }
+    encoder = EncoderCreate(DIGITAL_GROUP_ACTIVE(DigitalInputGroupRead(encoder_pins)));
+    self->encoder = encoder;
+
+    Chip_SCU_GPIOIntPinSel(ENCODER_CHANNEL, ENCODER_A_GPIO, ENCODER_A_BIT);
+    Chip_SCU_GPIOIntPinSel(ENCODER_CHANNEL + 1, ENCODER_B_GPIO, ENCODER_B_BIT);
+    for (uint8_t channel = ENCODER_CHANNEL; channel < ENCODER_CHANNEL + 2; channel++) {
+        Chip_PININT_ClearIntStatus(LPC_GPIO_PIN_INT, PININTCH(channel));
+        Chip_PININT_SetPinModeEdge(LPC_GPIO_PIN_INT, PININTCH(channel));
+        Chip_PININT_EnableIntLow(LPC_GPIO_PIN_INT, PININTCH(channel));
+        Chip_PININT_EnableIntHigh(LPC_GPIO_PIN_INT, PININTCH(channel));
+        // Por encima de las teclas, un flanco del encoder que se atiende tarde se pierde
+        NVIC_SetPriority((IRQn_Type)(PIN_INT0_IRQn + channel), configLIBRARY_MAX_SYSCALL_INTERRUPT_PRIORITY);
+        NVIC_ClearPendingIRQ((IRQn_Type)(PIN_INT0_IRQn + channel));
+        NVIC_EnableIRQ((IRQn_Type)(PIN_INT0_IRQn + channel));
+    }
+}
+
+static void EncoderIsr(uint8_t channel) {
+    // Se borra antes de leer, así un flanco que llega durante la lectura vuelve a pedir la interrupción
+    Chip_PININT_ClearIntStatus(LPC_GPIO_PIN_INT, PININTCH(channel));
+    EncoderEdgeFromIsr(encoder, DIGITAL_GROUP_ACTIVE(DigitalInputGroupRead(encoder_pins)), xTaskGetTickCountFromISR());
+}
+
+void GPIO6_IRQHandler(void) {
+    EncoderIsr(ENCODER_CHANNEL);
+}
+
+void GPIO7_IRQHandler(void) {
+    EncoderIsr(ENCODER_CHANNEL + 1);
+}
+#endif
+
+#if BOARD_DISPLAY_MAX7219
+static void SpiInit(void) {
+    Chip_SCU_PinMuxSet(SPI_MOSI_PORT, SPI_MOSI_PIN, SCU_MODE_INACT | SPI_MOSI_FUNC);
+    Chip_SCU_PinMuxSet(SPI_SCK_PORT, SPI_SCK_PIN, SCU_MODE_INACT | SPI_SCK_FUNC);
+    Chip_SCU_PinMuxSet(SPI_SSEL_PORT, SPI_SSEL_PIN, SCU_MODE_INACT | SPI_SSEL_FUNC);
+
+    // Con CPHA = 0 el SSP levanta SSEL entre palabras, y el MAX7219 toma cada registro en ese flanco
+    Chip_SSP_Init(LPC_SSP1);
+    Chip_SSP_SetFormat(LPC_SSP1, SSP_BITS_16, SSP_FRAMEFORMAT_SPI, SSP_CLOCK_CPHA0_CPOL0);
+    Chip_SSP_SetMaster(LPC_SSP1, true);
+    Chip_SSP_SetBitRate(LPC_SSP1, SPI_BITRATE);
+    Chip_SSP_Enable(LPC_SSP1);
+}
+
+static void SpiTransfer(const uint16_t * words, uint8_t count) {
+    // Lo recibido no se usa, se descarta para que la FIFO de recepción no se desborde
+    while (Chip_SSP_GetStatus(LPC_SSP1, SSP_STAT_RNE) == SET) {
+        Chip_SSP_ReceiveFrame(LPC_SSP1);
+    }
+    for (uint8_t index = 0; index < count; index++) {
+        while (Chip_SSP_GetStatus(LPC_SSP1, SSP_STAT_TNF) == RESET) {
+        }
+        Chip_SSP_SendFrame(LPC_SSP1, words[index]);
+    }
+}
+#endif
+
 /* === Public function implementation ============================================================================== */
 
 board_t BoardCreate(void) {
-    board_t board = malloc(sizeof(struct board_s));
-    if (board != NULL) {
-        BoardSetup();
-        BoardSetup();
-
-        DigitsInit();
-        SegmentsInit();
-        DigitalInputInit(board);
-        DigitalOutputInit(board);
-        board->display = DisplayCreate(4, &display_driver);
+    static struct board_s board[1];
+
+    BoardSetup();
+    BoardSetup();
+
+    DigitalInputInit(board);
+    DigitalOutputInit(board);
+    KeypadInit(board);
+    if (board->keypad == NULL) {
+        return NULL;
     }
-    return board;
+#if BOARD_ENCODER
+    EncoderInit(board);
+#else
+    board->encoder = NULL;
+#endif
+#if BOARD_DISPLAY_MAX7219
+    SpiInit();
+    board->display = DisplayCreate(BOARD_DISPLAY_DIGITS,
+                                   Max7219DriverCreate(&spi_port, BOARD_DISPLAY_DIGITS, MAX7219_INTENSITY));
+#else
+    DigitsInit();
+    SegmentsInit();
+    board->display = DisplayCreate(BOARD_DISPLAY_DIGITS, &display_driver);
+#endif
+    return board->display ? board : NULL;
 }
 
 void SysTickInit(uint32_t ticks) {
@@ -207,5 +456,34 @@ void SysTickInit(uint32_t ticks) {
     NVIC_SetPriority(SysTick_IRQn, (1 << __NVIC_PRIO_BITS) - 1);
 }
 
+void BoardRunTimeInit(void) {
+    static bool started = false;
+
+    // Lo pueden arrancar el registro de eventos y el sistema operativo, y la cuenta no tiene que volver a cero
+    if (started) {
+        return;
+    }
+    started = true;
+    // Sin interrupciones ni coincidencias: el sistema operativo solamente lee la cuenta en cada cambio de tarea
+    Chip_TIMER_Init(RUNTIME_STATS_TIMER);
+    Chip_TIMER_Reset(RUNTIME_STATS_TIMER);
+    Chip_TIMER_PrescaleSet(RUNTIME_STATS_TIMER, Chip_Clock_GetRate(RUNTIME_STATS_TIMER_CLK) / RUNTIME_STATS_HZ - 1);
+    Chip_TIMER_Enable(RUNTIME_STATS_TIMER);
+}
+
+void BoardWatchdogStart(void) {
+    Chip_WWDT_Init(LPC_WWDT);
+    Chip_WWDT_SetTimeOut(LPC_WWDT, (uint32_t)((uint64_t)SCAN_WATCHDOG_CLOCK_HZ * SCAN_WATCHDOG_TIMEOUT_MS / 1000));
+    Chip_WWDT_SetOption(LPC_WWDT, WWDT_WDMOD_WDRESET);
+    Chip_WWDT_Start(LPC_WWDT);
+}
+
+void BoardWatchdogFeed(void) {
+    // La secuencia de alimentación no se puede interrumpir con otro acceso al watchdog
+    taskENTER_CRITICAL();
+    Chip_WWDT_Feed(LPC_WWDT);
+    taskEXIT_CRITICAL();
+}
+
 /* === End of documentation ========================================================================================
  */
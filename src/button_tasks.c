@@ -23,61 +23,125 @@ SPDX-License-Identifier: MIT
 
 /* === Headers files inclusions =============================================================== */
 #include "button_tasks.h"
+#include "config.h"
+#include "bsp.h"
+#include "profile.h"
 
 /* === Macros definitions ====================================================================== */
-#define BUTTON_SCAN_DELAY 100
 
 /* === Private data type declarations ========================================================== */
 
 /* === Private variable declarations =========================================================== */
 
 /* === Private function declarations =========================================================== */
+/**
+ * @brief Pasa las pulsaciones y liberaciones del teclado al reconocedor de gestos
+ *
+ * @param key Número de tecla
+ * @param action Acción de la tecla
+ * @param timestamp Momento de la acción
+ * @param context Argumentos del objeto
+ */
+static void InputEvent(uint8_t key, keypad_action_t action, uint32_t timestamp, void * context);
+
+/**
+ * @brief Encola los gestos reconocidos como eventos del reloj
+ *
+ * @param gesture Gesto reconocido
+ * @param context Argumentos del objeto
+ */
+static void InputGesture(gesture_event_t gesture, void * context);
+
+/**
+ * @brief Encola los pasos del encoder como incrementos o decrementos con la cantidad de pasos
+ *
+ * @param args Argumentos del objeto
+ * @param now Tiempo actual
+ */
+static void InputEncoder(input_task_args_t args, uint32_t now);
 
 /* === Public variable definitions ============================================================= */
 
 /* === Private variable definitions ============================================================ */
 
 /* === Private function implementation ========================================================= */
+static void InputEvent(uint8_t key, keypad_action_t action, uint32_t timestamp, void * context) {
+    input_task_args_t args = (input_task_args_t)context;
 
-/* === Public function implementation ========================================================= */
+    // Las pulsaciones largas las decide el reconocedor de gestos
+    if (action != KEYPAD_LONG_PRESSED) {
+        GestureKey(args->gesture, key, action == KEYPAD_PRESSED, timestamp, InputGesture, args);
+    }
+}
 
-void ButtonTask(void * pointer) {
-    button_task_args_t args = (button_task_args_t)pointer;
+static void InputGesture(gesture_event_t gesture, void * context) {
+    static const uint8_t kinds[] = {
+        [GESTURE_PRESS] = INPUT_KEY_PRESSED,   [GESTURE_LONG] = INPUT_KEY_LONG_PRESSED,
+        [GESTURE_DOUBLE] = INPUT_KEY_DOUBLE,   [GESTURE_REPEAT] = INPUT_KEY_REPEAT,
+        [GESTURE_CHORD] = INPUT_KEY_CHORD,
+    };
+    input_task_args_t args = (input_task_args_t)context;
+    input_event_t event = {
+        .timestamp = gesture->timestamp,
+        .source = INPUT_SOURCE_KEY,
+        .kind = kinds[gesture->kind],
+        .code = gesture->key,
+        .other = gesture->other,
+    };
+
+    ActivePost(args->target, &event);
+}
+
+static void InputEncoder(input_task_args_t args, uint32_t now) {
+    int32_t steps = EncoderTake(args->encoder);
+    uint32_t count = (steps < 0) ? (uint32_t)-steps : (uint32_t)steps;
+    input_event_t event = {
+        .timestamp = now,
+        .source = INPUT_SOURCE_ENCODER,
+        .kind = INPUT_ENCODER_STEPS,
+        .code = (steps < 0) ? BOARD_KEY_DECREMENT : BOARD_KEY_INCREMENT,
+    };
+
+    while (count > 0) {
+        event.other = (count > UINT8_MAX) ? UINT8_MAX : count;
+        count -= event.other;
+        ActivePost(args->target, &event);
+    }
+}
 
-    while (true) {
-        while (!DigitalInputGetIsActive(args->button)) {
-            vTaskDelay(pdMS_TO_TICKS(BUTTON_SCAN_DELAY));
-        };
+/* === Public function implementation ========================================================= */
 
-        xEventGroupSetBits(args->clock_events, args->event_bit);
+void InputHandler(const input_event_t * event, void * context) {
+    input_task_args_t args = (input_task_args_t)context;
+    uint32_t now = xTaskGetTickCount() * portTICK_PERIOD_MS;
+    uint32_t wait;
+    uint32_t gesture_wait;
 
-        while (DigitalInputGetIsActive(args->button)) {
-            vTaskDelay(pdMS_TO_TICKS(BUTTON_SCAN_DELAY));
-        };
+    if (event->kind != INPUT_KEY_POLL) {
+        return;
     }
-}
-void ButtonPressedForLongTimeTask(void * pointer) {
-    button_task_args_t args = (button_task_args_t)pointer;
-
-    while (true) {
-        if (DigitalInputGetIsActive(args->button)) {
-            if (!args->state->pressed) {
-                args->state->pressed = true;
-                args->state->start_time = xTaskGetTickCount();
-            } else {
-                if ((xTaskGetTickCount() - args->state->start_time) >= pdMS_TO_TICKS(args->state->delay_ms) &&
-                    !args->state->already_pressed) {
-                    args->state->already_pressed = true;
-                    xEventGroupSetBits(args->clock_events, args->event_bit);
-                }
-            }
-        } else {
-            args->state->pressed = false;
-            args->state->already_pressed = false;
-            args->state->start_time = 0;
-        }
-        vTaskDelay(pdMS_TO_TICKS(BUTTON_SCAN_DELAY));
+    PROFILE_BEGIN(PROFILE_INPUT);
+    wait = KeypadProcess(args->keypad, now, InputEvent, args);
+    gesture_wait = GestureProcess(args->gesture, now, InputGesture, args);
+    if (gesture_wait < wait) {
+        wait = gesture_wait;
+    }
+    if (args->encoder != NULL) {
+        InputEncoder(args, now);
+    }
+    if (wait == KEYPAD_NO_DEADLINE) {
+        ActiveTimerStop(args->poll);
+    } else {
+        ActiveTimerStart(args->poll, wait, 0);
     }
+    PROFILE_END(PROFILE_INPUT);
+}
+
+void InputNotifyFromIsr(void * context) {
+    BaseType_t woken = pdFALSE;
+
+    xTaskNotifyFromISR((TaskHandle_t)context, INPUT_NOTIFY_BIT, eSetBits, &woken);
+    portYIELD_FROM_ISR(woken);
 }
 
 /* === End of documentation ==================================================================== */
@@ -41,9 +41,14 @@ struct clock_s {
     bool valid_alarm;
     bool alarm_active;
     bool alarm_enable;
+    uint8_t changes; //!< Cambios CLOCK_CHANGED_* sin consultar
+    bool synced;      //!< Ya se tomó la referencia del contador de ticks
+    uint32_t counter; //!< Lectura del contador de ticks en la sincronización anterior
     clock_alarm_driver_t driver;
 };
 
+_Static_assert(sizeof(struct clock_s) <= CLOCK_RAM, "CLOCK_RAM no alcanza para el reloj");
+
 /* === Private function declarations =============================================================================== */
 /**
  * @brief Verifica si la hora dada en BCD es válida
@@ -70,6 +75,13 @@ void SecondsToBCD(clock_time_t * time, uint32_t seconds);
  */
 uint32_t BCDToSeconds(const clock_time_t * time);
 
+/**
+ * @brief Avanza la hora un segundo y revisa la alarma
+ *
+ * @param self Puntero al objeto reloj
+ */
+static void ClockSecondElapsed(clock_t self);
+
 /* === Private variable definitions ================================================================================ */
 
 /* === Public variable definitions ================================================================================= */
@@ -108,6 +120,18 @@ void SecondsToBCD(clock_time_t * time, uint32_t total_seconds) {
     time->time.seconds[0] = seconds % 10;
 }
 
+static void ClockSecondElapsed(clock_t self) {
+    uint32_t total_seconds = BCDToSeconds(&self->current_time);
+
+    total_seconds = (total_seconds + 1) % (24 * 3600);
+    SecondsToBCD(&self->current_time, total_seconds);
+    self->changes |= CLOCK_CHANGED_SECONDS;
+    if (total_seconds % 60 == 0) {
+        self->changes |= CLOCK_CHANGED_MINUTES;
+    }
+    ClockActivateAlarm(self, true);
+}
+
 /* === Public function implementation ============================================================================== */
 
 clock_t ClockCreate(uint32_t ticks_per_second, uint32_t alarm_postponed_minutes, clock_alarm_driver_t driver_alarm) {
@@ -138,6 +162,7 @@ bool ClockSetTime(clock_t self, const clock_time_t * new_time) {
 
     if (ClockIsValidTime(new_time)) {
         self->valid = true;
+        self->changes |= CLOCK_CHANGED_SECONDS | CLOCK_CHANGED_MINUTES;
         memcpy(&self->current_time, new_time, sizeof(clock_time_t));
     } else {
         self->valid = false;
@@ -154,6 +179,9 @@ bool ClockSetAlarm(clock_t self, const clock_time_t * new_alarm) {
     if (ClockIsValidTime(new_alarm)) {
         self->valid_alarm = true;
         self->alarm_enable = true;
+        if (self->alarm_active) {
+            self->changes |= CLOCK_CHANGED_ALARM;
+        }
         self->alarm_active = false;
         self->driver->AlarmDeactivate();
         memcpy(&self->alarm_time, new_alarm, sizeof(clock_time_t));
@@ -186,6 +214,9 @@ bool ClockActivateAlarm(clock_t self, bool activate) {
     if (activate) {
         if (memcmp(self->current_time.bcd, self->alarm_time.bcd, sizeof(clock_time_t)) == 0 &&
             self->alarm_enable == true) {
+            if (!self->alarm_active) {
+                self->changes |= CLOCK_CHANGED_ALARM;
+            }
             self->alarm_active = true;
             self->driver->AlarmActivate();
         }
@@ -200,6 +231,9 @@ bool ClockActivateAlarm(clock_t self, bool activate) {
         }
 
     } else {
+        if (self->alarm_active) {
+            self->changes |= CLOCK_CHANGED_ALARM;
+        }
         self->alarm_active = false;
         self->driver->AlarmDeactivate();
         alarm_seconds = (alarm_seconds - postpone_seconds) % (24 * 3600);
@@ -229,6 +263,9 @@ bool ClockPostponeAlarm(clock_t self) {
     uint32_t postpone_seconds = 60 * self->postponed_minutes;
 
     self->alarm_postponed_times++;
+    if (self->alarm_active) {
+        self->changes |= CLOCK_CHANGED_ALARM;
+    }
     self->alarm_active = false;
     self->driver->AlarmDeactivate();
     uint32_t alarm_seconds = BCDToSeconds(&self->alarm_time);
@@ -244,14 +281,78 @@ bool ClockNewTick(clock_t self) {
     self->clock_ticks++;
     if (self->clock_ticks == self->ticks_per_second) {
         self->clock_ticks = 0;
+        ClockSecondElapsed(self);
+    }
+    return true;
+}
+
+bool ClockSync(clock_t self, uint32_t counter) {
+    uint32_t elapsed;
+    uint32_t seconds;
 
-        uint32_t total_seconds = BCDToSeconds(&self->current_time);
-        total_seconds = (total_seconds + 1) % (24 * 3600);
-        SecondsToBCD(&self->current_time, total_seconds);
-        ClockActivateAlarm(self, true);
+    if (!self) {
+        return false;
+    }
+    if (!self->synced) {
+        self->synced = true;
+        self->counter = counter;
+        return true;
+    }
+
+    // La resta sin signo mide bien el tiempo aunque el contador desborde entre dos lecturas
+    elapsed = counter - self->counter;
+    self->counter = counter;
+    seconds = elapsed / self->ticks_per_second;
+    self->clock_ticks += elapsed % self->ticks_per_second;
+    if (self->clock_ticks >= self->ticks_per_second) {
+        self->clock_ticks -= self->ticks_per_second;
+        seconds++;
+    }
+    // Se avanza de a un segundo para no saltear la alarma aunque se haya sincronizado muy tarde
+    while (seconds > 0) {
+        ClockSecondElapsed(self);
+        seconds--;
     }
     return true;
 }
 
+uint8_t ClockTakeChanges(clock_t self) {
+    uint8_t changes = 0;
+
+    if (self) {
+        changes = self->changes;
+        self->changes = 0;
+    }
+    return changes;
+}
+
+uint32_t ClockTicksToChange(clock_t self, uint8_t changes) {
+    uint32_t ticks = CLOCK_NO_CHANGE;
+    uint32_t to_second;
+    uint32_t seconds;
+    uint32_t wait;
+
+    if (!self) {
+        return CLOCK_NO_CHANGE;
+    }
+
+    to_second = self->ticks_per_second - self->clock_ticks;
+    seconds = BCDToSeconds(&self->current_time);
+    if (changes & CLOCK_CHANGED_SECONDS) {
+        ticks = to_second;
+    }
+    if (changes & CLOCK_CHANGED_MINUTES) {
+        wait = to_second + (59 - seconds % 60) * self->ticks_per_second;
+        ticks = (wait < ticks) ? wait : ticks;
+    }
+    if ((changes & CLOCK_CHANGED_ALARM) && self->valid_alarm && self->alarm_enable && !self->alarm_active) {
+        // La alarma se compara al cambiar el segundo, así que suena cuando la hora llega a la de la alarma
+        wait = (BCDToSeconds(&self->alarm_time) + 24 * 3600 - seconds - 1) % (24 * 3600);
+        wait = to_second + wait * self->ticks_per_second;
+        ticks = (wait < ticks) ? wait : ticks;
+    }
+    return ticks;
+}
+
 /* === End of documentation ========================================================================================
  */
@@ -25,15 +25,126 @@ SPDX-License-Identifier: MIT
 #include "clock_tasks.h"
 #include "button_tasks.h"
 #include "display_tasks.h"
+#include "power.h"
+#include "profile.h"
 /* === Macros definitions ====================================================================== */
-#define FLASH_FREQUENCY 200 ///< Cantidad de veces que se quiere que el digito este prendido
+#define FLASH_TIME_ON_MS   800  ///< Tiempo en ms que el digito esta prendido al parpadear
+#define POINT_BLINK_PERIOD 1000 ///< Período en ms del parpadeo del punto al mostrar la hora
+
+#define HOUR_MINUTE_DIGITS 4 ///< Dígitos de horas y minutos
+#define TIME_DIGITS        6 ///< Dígitos de horas, minutos y segundos
+
+#define STAY               0         ///< Transición que no cambia de modo
+#define TO(mode)           ((mode) + 1) ///< Transición que entra a un modo, aunque sea el mismo
+
+#define BANNER_TIME_MS     1500 ///< Tiempo en ms que se muestra un cartel
+#define MARQUEE_STEP_MS    320  ///< Tiempo en ms de cada paso de la marquesina
+
+#define CHAR_A             (SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_E | SEGMENT_F | SEGMENT_G)
+#define CHAR_F             (SEGMENT_A | SEGMENT_E | SEGMENT_F | SEGMENT_G)
+#define CHAR_L             (SEGMENT_D | SEGMENT_E | SEGMENT_F)
+#define CHAR_O             (SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_E | SEGMENT_F)
+#define CHAR_n             (SEGMENT_C | SEGMENT_E | SEGMENT_G)
+#define CHAR_r             (SEGMENT_E | SEGMENT_G)
 
 /* === Private data type declarations ========================================================== */
+//! Señales de la máquina de modos, cada evento se convierte en una sola
+typedef enum {
+    SIGNAL_NONE,           ///< Evento que solamente vuelve a mostrar el modo actual
+    SIGNAL_ACCEPT,         ///< Tecla aceptar, el orden de las teclas es el de BOARD_KEY_*
+    SIGNAL_CANCEL,         ///< Tecla cancelar
+    SIGNAL_INCREMENT,      ///< Tecla incrementar o encoder hacia adelante
+    SIGNAL_DECREMENT,      ///< Tecla decrementar o encoder hacia atrás
+    SIGNAL_SET_TIME,       ///< Pulsación larga de la tecla de ajustar la hora
+    SIGNAL_SET_ALARM,      ///< Pulsación larga de la tecla de ajustar la alarma
+    SIGNAL_RESET_VALUE,    ///< Incrementar y decrementar juntas
+    SIGNAL_INACTIVITY,     ///< Pasó el tiempo máximo sin actividad
+    SIGNAL_ANIMATION_DONE, ///< Terminó un cartel o la marquesina
+    SIGNALS,               ///< Cantidad de señales
+} clock_signal_t;
+
+//! Acciones de las transiciones, índices de la tabla ACTIONS
+typedef enum {
+    ACTION_NONE,
+    ACTION_INCREMENT,
+    ACTION_DECREMENT,
+    ACTION_RESET_VALUE,
+    ACTION_LOAD_ALARM,
+    ACTION_ALARM_ACCEPT,
+    ACTION_ALARM_CANCEL,
+    ACTION_CANCEL_TIME,
+    ACTION_SAVE_TIME,
+    ACTION_SAVE_ALARM,
+} clock_action_id_t;
+
+//! Valores que se ajustan en los modos de configuración
+typedef enum {
+    FIELD_NONE,
+    FIELD_MINUTE,
+    FIELD_HOUR,
+} clock_field_t;
+
+//! Acción de una transición o vista de un modo
+typedef void (*clock_action_t)(clock_task_args_t args, const input_event_t * event);
+
+//! Transición de la máquina de modos
+struct clock_transition_s {
+    uint8_t action; //!< Acción a ejecutar, uno de clock_action_id_t
+    uint8_t next;   //!< Modo siguiente con TO(), o STAY para quedarse sin volver a entrar
+};
+
+//! Atributos de un modo, que fijan lo que muestra la pantalla al entrar y con cada evento
+struct clock_mode_s {
+    clock_action_t view; //!< Escribe la pantalla con cada evento, antes de la acción de la transición
+    uint8_t field;       //!< Valor que cambian incrementar y decrementar, uno de clock_field_t
+    uint8_t flash_from;  //!< Primer dígito que parpadea
+    uint8_t flash_to;    //!< Último dígito que parpadea
+    bool flash;          //!< Si los dígitos flash_from a flash_to parpadean
+    uint8_t flash_point; //!< Máscara de puntos que parpadean
+    uint8_t point_mask;  //!< Máscara de los puntos de horas y minutos que fija el modo
+    uint8_t points;      //!< Puntos de point_mask que quedan encendidos
+    bool separators;     //!< Si se muestran los separadores de la hora según la cantidad de dígitos
+};
 
 /* === Private variable declarations =========================================================== */
 static const uint8_t MINUTE_LIMIT[] = {6, 0};
 static const uint8_t HOUR_LIMIT[] = {2, 4};
 
+//! Límite de cada valor que se ajusta
+static const uint8_t * const LIMITS[] = {
+    [FIELD_MINUTE] = MINUTE_LIMIT,
+    [FIELD_HOUR] = HOUR_LIMIT,
+};
+
+//! Cartel "AL On" al habilitar la alarma, con los dígitos que sobran a la derecha apagados
+static const uint8_t ALARM_ON_SEGMENTS[BOARD_DISPLAY_DIGITS] = {CHAR_A, CHAR_L, CHAR_O, CHAR_n};
+static const struct display_animation_s ALARM_ON_BANNER = {
+    .segments = ALARM_ON_SEGMENTS,
+    .frames = 1,
+    .width = BOARD_DISPLAY_DIGITS,
+    .stride = BOARD_DISPLAY_DIGITS,
+};
+
+//! Cartel "AL OF" al deshabilitar la alarma
+static const uint8_t ALARM_OFF_SEGMENTS[BOARD_DISPLAY_DIGITS] = {CHAR_A, CHAR_L, CHAR_O, CHAR_F};
+static const struct display_animation_s ALARM_OFF_BANNER = {
+    .segments = ALARM_OFF_SEGMENTS,
+    .frames = 1,
+    .width = BOARD_DISPLAY_DIGITS,
+    .stride = BOARD_DISPLAY_DIGITS,
+};
+
+//! Texto "ALArnnA" que entra y sale de la pantalla cuando suena la alarma, con una pantalla apagada a cada lado
+static const uint8_t ALARM_MARQUEE_SEGMENTS[BOARD_DISPLAY_DIGITS + 7 + BOARD_DISPLAY_DIGITS] = {
+    [BOARD_DISPLAY_DIGITS] = CHAR_A, CHAR_L, CHAR_A, CHAR_r, CHAR_n, CHAR_n, CHAR_A,
+};
+static const struct display_animation_s ALARM_MARQUEE = {
+    .segments = ALARM_MARQUEE_SEGMENTS,
+    .frames = sizeof(ALARM_MARQUEE_SEGMENTS) - BOARD_DISPLAY_DIGITS + 1,
+    .width = BOARD_DISPLAY_DIGITS,
+    .stride = 1,
+};
+
 /* === Private function declarations =========================================================== */
 
 /**
@@ -59,11 +170,25 @@ void BCDDecrement(uint8_t number[2], const uint8_t limit[2]);
  * `BCD[1] = unidad de la hora`
  * `BCD[2] = decena del minuto`
  * `BCD[3] = unidad del minuto`
+ * `BCD[4] = decena del segundo`
+ * `BCD[5] = unidad del segundo`
  *
  * @param time  Puntero a la estructura de tiempo  clock_time_t
- * @param BCD Puntero a un arreglo de 4 elementos donde se almacenará el tiempo
+ * @param BCD Puntero a un arreglo de 6 elementos donde se almacenará el tiempo
  */
 void ClockTimeToBCD(clock_time_t * time, uint8_t * BCD);
+
+/**
+ * @brief Ordena un tiempo BCD de 6 elementos según la cantidad de dígitos de la pantalla
+ *
+ * Con 4 dígitos se muestra HHMM, con 6 HHMMSS y con 8 HH-MM-SS.
+ *
+ * @param BCD Tiempo en el formato de ClockTimeToBCD
+ * @param value Arreglo donde se almacenan los valores para DisplayWrite
+ * @param digits Cantidad de dígitos de la pantalla
+ * @return uint8_t Cantidad de valores escritos
+ */
+uint8_t BCDToDisplay(uint8_t * BCD, uint8_t * value, uint8_t digits);
 /**
  * @brief Convierte un tiempo de un arreglo BCD de 4 dígitos a clock_time_t
  *
@@ -91,9 +216,224 @@ void BCDtoHourAndMinute(uint8_t hour[], uint8_t minute[], uint8_t BCD[]);
  */
 void HourAndMinuteToBCD(uint8_t hour[], uint8_t minute[], uint8_t BCD[]);
 
+/**
+ * @brief Entra a un modo, fijando el parpadeo y los puntos de la pantalla según su fila de MODES
+ *
+ * @param value Modo al que se entra
+ * @param args Argumentos del objeto del reloj
+ */
+static void ChangeMode(mode_t value, clock_task_args_t args);
+
+/**
+ * @brief Convierte un evento en la señal que usa la máquina de modos
+ *
+ * Las repeticiones de incrementar y decrementar cuentan como pulsaciones, y las teclas de configuración solamente
+ * responden a la pulsación larga. Los pasos del encoder usan la señal de incrementar o decrementar.
+ *
+ * @param event Evento recibido
+ * @return clock_signal_t Señal del evento, SIGNAL_NONE si no corresponde a ninguna
+ */
+static clock_signal_t EventSignal(const input_event_t * event);
+
+/**
+ * @brief Muestra la hora actual y la guarda como punto de partida de un ajuste
+ *
+ * @param args Argumentos del objeto del reloj
+ * @param event Evento recibido
+ */
+static void ViewTime(clock_task_args_t args, const input_event_t * event);
+
+/**
+ * @brief Muestra la hora actual con los puntos de la alarma y arranca la marquesina cuando empieza a sonar
+ *
+ * @param args Argumentos del objeto del reloj
+ * @param event Evento recibido
+ */
+static void ViewClock(clock_task_args_t args, const input_event_t * event);
+
+/**
+ * @brief Muestra las horas y minutos que se están ajustando
+ *
+ * @param args Argumentos del objeto del reloj
+ * @param event Evento recibido
+ */
+static void ViewEdit(clock_task_args_t args, const input_event_t * event);
+
+/**
+ * @brief Incrementa el valor que ajusta el modo, una vez por paso del encoder
+ *
+ * @param args Argumentos del objeto del reloj
+ * @param event Evento recibido
+ */
+static void ActionIncrement(clock_task_args_t args, const input_event_t * event);
+
+/**
+ * @brief Decrementa el valor que ajusta el modo, una vez por paso del encoder
+ *
+ * @param args Argumentos del objeto del reloj
+ * @param event Evento recibido
+ */
+static void ActionDecrement(clock_task_args_t args, const input_event_t * event);
+
+/**
+ * @brief Pone en cero el valor que ajusta el modo
+ *
+ * @param args Argumentos del objeto del reloj
+ * @param event Evento recibido
+ */
+static void ActionResetValue(clock_task_args_t args, const input_event_t * event);
+
+/**
+ * @brief Toma la hora de la alarma como punto de partida de su ajuste
+ *
+ * @param args Argumentos del objeto del reloj
+ * @param event Evento recibido
+ */
+static void ActionLoadAlarm(clock_task_args_t args, const input_event_t * event);
+
+/**
+ * @brief Pospone la alarma si está sonando, o la habilita si ya fue configurada
+ *
+ * @param args Argumentos del objeto del reloj
+ * @param event Evento recibido
+ */
+static void ActionAlarmAccept(clock_task_args_t args, const input_event_t * event);
+
+/**
+ * @brief Apaga la alarma si está sonando, o la deshabilita si ya fue configurada
+ *
+ * @param args Argumentos del objeto del reloj
+ * @param event Evento recibido
+ */
+static void ActionAlarmCancel(clock_task_args_t args, const input_event_t * event);
+
+/**
+ * @brief Sale del ajuste de la hora sin guardar, a mostrar la hora si es válida o a esperar que se configure
+ *
+ * @param args Argumentos del objeto del reloj
+ * @param event Evento recibido
+ */
+static void ActionCancelTime(clock_task_args_t args, const input_event_t * event);
+
+/**
+ * @brief Guarda la hora ajustada en el reloj
+ *
+ * @param args Argumentos del objeto del reloj
+ * @param event Evento recibido
+ */
+static void ActionSaveTime(clock_task_args_t args, const input_event_t * event);
+
+/**
+ * @brief Guarda la hora de la alarma ajustada
+ *
+ * @param args Argumentos del objeto del reloj
+ * @param event Evento recibido
+ */
+static void ActionSaveAlarm(clock_task_args_t args, const input_event_t * event);
+
+/**
+ * @brief Avisa al objeto del reloj que terminó una animación de la pantalla
+ *
+ * @param display Display que terminó la animación
+ * @param context Objeto activo del reloj
+ */
+static void AnimationDone(display_t display, void * context);
+
+/**
+ * @brief Reproduce una animación con cuadros de una duración dada
+ *
+ * La duración se convierte a barridos al reproducir, porque los barridos por segundo cambian con la cantidad de
+ * dígitos y con el brillo.
+ *
+ * @param animation Animación a reproducir, sin duración
+ * @param frame_ms Duración de cada cuadro en ms
+ * @param args Argumentos del objeto del reloj
+ */
+static void ShowAnimation(display_animation_t animation, uint32_t frame_ms, clock_task_args_t args);
+
 /* === Public variable definitions ============================================================= */
 
 /* === Private variable definitions ============================================================ */
+//! Acciones de las transiciones
+static const clock_action_t ACTIONS[] = {
+    [ACTION_NONE] = NULL,
+    [ACTION_INCREMENT] = ActionIncrement,
+    [ACTION_DECREMENT] = ActionDecrement,
+    [ACTION_RESET_VALUE] = ActionResetValue,
+    [ACTION_LOAD_ALARM] = ActionLoadAlarm,
+    [ACTION_ALARM_ACCEPT] = ActionAlarmAccept,
+    [ACTION_ALARM_CANCEL] = ActionAlarmCancel,
+    [ACTION_CANCEL_TIME] = ActionCancelTime,
+    [ACTION_SAVE_TIME] = ActionSaveTime,
+    [ACTION_SAVE_ALARM] = ActionSaveAlarm,
+};
+
+//! Atributos de cada modo
+static const struct clock_mode_s MODES[] = {
+    [UNSET_TIME] = {.view = ViewTime, .flash_from = 0, .flash_to = 3, .flash = true, .flash_point = 0x02,
+                    .point_mask = 0x0F},
+    [SHOW_TIME] = {.view = ViewClock, .point_mask = 0x04, .separators = true},
+    [SET_TIME_MINUTE] = {.view = ViewEdit, .field = FIELD_MINUTE, .flash_from = 2, .flash_to = 3, .flash = true,
+                         .point_mask = 0x0F},
+    [SET_TIME_HOUR] = {.view = ViewEdit, .field = FIELD_HOUR, .flash_from = 0, .flash_to = 1, .flash = true,
+                       .point_mask = 0x0F},
+    [SET_ALARM_MINUTE] = {.view = ViewEdit, .field = FIELD_MINUTE, .flash_from = 2, .flash_to = 3, .flash = true,
+                          .point_mask = 0x0F, .points = 0x0F},
+    [SET_ALARM_HOUR] = {.view = ViewEdit, .field = FIELD_HOUR, .flash_from = 0, .flash_to = 1, .flash = true,
+                        .point_mask = 0x0F, .points = 0x0F},
+};
+
+//! Incrementar, decrementar y poner en cero son iguales en todos los modos de configuración
+#define EDIT_TRANSITIONS                                                                                               \
+    [SIGNAL_INCREMENT] = {ACTION_INCREMENT, STAY}, [SIGNAL_DECREMENT] = {ACTION_DECREMENT, STAY},                     \
+    [SIGNAL_RESET_VALUE] = {ACTION_RESET_VALUE, STAY}
+
+//! Transiciones de cada modo con cada señal, las que no figuran no hacen nada
+static const struct clock_transition_s TRANSITIONS[][SIGNALS] = {
+    [UNSET_TIME] =
+        {
+            [SIGNAL_SET_TIME] = {ACTION_NONE, TO(SET_TIME_MINUTE)},
+        },
+    [SHOW_TIME] =
+        {
+            [SIGNAL_ACCEPT] = {ACTION_ALARM_ACCEPT, STAY},
+            [SIGNAL_CANCEL] = {ACTION_ALARM_CANCEL, STAY},
+            [SIGNAL_SET_TIME] = {ACTION_NONE, TO(SET_TIME_MINUTE)},
+            [SIGNAL_SET_ALARM] = {ACTION_LOAD_ALARM, TO(SET_ALARM_MINUTE)},
+            [SIGNAL_ANIMATION_DONE] = {ACTION_NONE, TO(SHOW_TIME)}, // Al terminar un cartel vuelve el parpadeo
+        },
+    [SET_TIME_MINUTE] =
+        {
+            EDIT_TRANSITIONS,
+            [SIGNAL_ACCEPT] = {ACTION_NONE, TO(SET_TIME_HOUR)},
+            [SIGNAL_CANCEL] = {ACTION_CANCEL_TIME, STAY},
+            [SIGNAL_INACTIVITY] = {ACTION_CANCEL_TIME, STAY},
+        },
+    [SET_TIME_HOUR] =
+        {
+            EDIT_TRANSITIONS,
+            [SIGNAL_ACCEPT] = {ACTION_SAVE_TIME, TO(SHOW_TIME)},
+            [SIGNAL_CANCEL] = {ACTION_CANCEL_TIME, STAY},
+            [SIGNAL_INACTIVITY] = {ACTION_CANCEL_TIME, STAY},
+        },
+    [SET_ALARM_MINUTE] =
+        {
+            EDIT_TRANSITIONS,
+            [SIGNAL_ACCEPT] = {ACTION_NONE, TO(SET_ALARM_HOUR)},
+            [SIGNAL_CANCEL] = {ACTION_NONE, TO(SHOW_TIME)},
+            [SIGNAL_INACTIVITY] = {ACTION_NONE, TO(SHOW_TIME)},
+        },
+    [SET_ALARM_HOUR] =
+        {
+            EDIT_TRANSITIONS,
+            [SIGNAL_ACCEPT] = {ACTION_SAVE_ALARM, TO(SHOW_TIME)},
+            [SIGNAL_CANCEL] = {ACTION_NONE, TO(SHOW_TIME)},
+            [SIGNAL_INACTIVITY] = {ACTION_NONE, TO(SHOW_TIME)},
+        },
+};
+
+_Static_assert(sizeof(MODES) / sizeof(MODES[0]) == MODES_COUNT, "Falta un modo en la tabla MODES");
+_Static_assert(sizeof(TRANSITIONS) / sizeof(TRANSITIONS[0]) == MODES_COUNT, "Falta un modo en TRANSITIONS");
 
 /* === Private function implementation ========================================================= */
 void BCDIncrement(uint8_t number[2], const uint8_t limit[2]) {
@@ -131,6 +471,20 @@ void ClockTimeToBCD(clock_time_t * time, uint8_t * BCD) {
     BCD[1] = time->time.hours[0];
     BCD[2] = time->time.minutes[1];
     BCD[3] = time->time.minutes[0];
+    BCD[4] = time->time.seconds[1];
+    BCD[5] = time->time.seconds[0];
+}
+
+uint8_t BCDToDisplay(uint8_t * BCD, uint8_t * value, uint8_t digits) {
+    uint8_t count = 0;
+
+    for (uint8_t i = 0; i < TIME_DIGITS && count < digits; i++) {
+        if (digits >= 8 && (i == 2 || i == 4)) {
+            value[count++] = DISPLAY_DASH;
+        }
+        value[count++] = BCD[i];
+    }
+    return count;
 }
 
 void BCDToClockTime(clock_time_t * time, uint8_t * BCD) {
@@ -156,244 +510,268 @@ void HourAndMinuteToBCD(uint8_t hour[], uint8_t minute[], uint8_t BCD[]) {
     BCD[3] = minute[1];
 }
 
-void ChangeMode(mode_t value, clock_task_args_t args) {
+static clock_signal_t EventSignal(const input_event_t * event) {
+    switch (event->kind) {
+    case INPUT_KEY_PRESSED:
+        if (event->code == BOARD_KEY_SET_TIME || event->code == BOARD_KEY_SET_ALARM) {
+            return SIGNAL_NONE;
+        }
+        return SIGNAL_ACCEPT + event->code;
+    case INPUT_KEY_REPEAT:
+    case INPUT_KEY_LONG_PRESSED:
+    case INPUT_ENCODER_STEPS:
+        return SIGNAL_ACCEPT + event->code;
+    case INPUT_KEY_CHORD:
+        if ((1UL << event->code | 1UL << event->other) == (1UL << BOARD_KEY_INCREMENT | 1UL << BOARD_KEY_DECREMENT)) {
+            return SIGNAL_RESET_VALUE;
+        }
+        return SIGNAL_NONE;
+    case INPUT_TIMER_INACTIVITY:
+        return SIGNAL_INACTIVITY;
+    case INPUT_ANIMATION_DONE:
+        return SIGNAL_ANIMATION_DONE;
+    default:
+        return SIGNAL_NONE;
+    }
+}
+
+static void ViewTime(clock_task_args_t args, const input_event_t * event) {
+    uint8_t digits[TIME_DIGITS];
+    uint8_t shown[DISPLAY_MAX_DIGITS];
+    clock_time_t time;
+
+    (void)event;
+    ClockGetTime(args->clock, &time);
+    ClockTimeToBCD(&time, digits);
+    BCDtoHourAndMinute(args->hour, args->minute, digits);
+    DisplayWrite(args->board->display, shown, BCDToDisplay(digits, shown, DisplayDigits(args->board->display)));
+}
+
+static void ViewClock(clock_task_args_t args, const input_event_t * event) {
+    ViewTime(args, event);
+    DisplaySetPoint(args->board->display, 0, ClockIsAlarmActive(args->clock));
+    DisplaySetPoint(args->board->display, DisplayDigits(args->board->display) - 1, ClockIsAlarmEnabled(args->clock));
+    if (ClockIsAlarmActive(args->clock) && !args->alarm_was_active) {
+        ShowAnimation(&ALARM_MARQUEE, MARQUEE_STEP_MS, args);
+    }
+    args->alarm_was_active = ClockIsAlarmActive(args->clock);
+}
+
+static void ViewEdit(clock_task_args_t args, const input_event_t * event) {
+    uint8_t digits[HOUR_MINUTE_DIGITS];
+
+    (void)event;
+    HourAndMinuteToBCD(args->hour, args->minute, digits);
+    DisplayWrite(args->board->display, digits, HOUR_MINUTE_DIGITS);
+}
+
+static void ActionIncrement(clock_task_args_t args, const input_event_t * event) {
+    uint8_t field = MODES[args->current_mode].field;
+    uint8_t steps = (event->kind == INPUT_ENCODER_STEPS) ? event->other : 1;
+
+    for (uint8_t step = 0; step < steps; step++) {
+        BCDIncrement((field == FIELD_HOUR) ? args->hour : args->minute, LIMITS[field]);
+    }
+}
+
+static void ActionDecrement(clock_task_args_t args, const input_event_t * event) {
+    uint8_t field = MODES[args->current_mode].field;
+    uint8_t steps = (event->kind == INPUT_ENCODER_STEPS) ? event->other : 1;
+
+    for (uint8_t step = 0; step < steps; step++) {
+        BCDDecrement((field == FIELD_HOUR) ? args->hour : args->minute, LIMITS[field]);
+    }
+}
+
+static void ActionResetValue(clock_task_args_t args, const input_event_t * event) {
+    uint8_t * value = (MODES[args->current_mode].field == FIELD_HOUR) ? args->hour : args->minute;
+
+    (void)event;
+    value[0] = 0;
+    value[1] = 0;
+}
+
+static void ActionLoadAlarm(clock_task_args_t args, const input_event_t * event) {
+    uint8_t digits[TIME_DIGITS];
+    clock_time_t time;
+
+    ClockGetAlarm(args->clock, &time);
+    ClockTimeToBCD(&time, digits);
+    BCDtoHourAndMinute(args->hour, args->minute, digits);
+    ViewEdit(args, event);
+}
+
+static void ActionAlarmAccept(clock_task_args_t args, const input_event_t * event) {
+    (void)event;
+    // Solamente se puede habilitar y deshabilitar la alarma cuando ya se la configuró por primera vez
+    if (!ClockIsAlarmActive(args->clock) && args->alarm_already_set) {
+        ClockAlarmEnable(args->clock, true);
+        ShowAnimation(&ALARM_ON_BANNER, BANNER_TIME_MS, args);
+    } else {
+        DisplayStop(args->board->display);
+        ClockPostponeAlarm(args->clock);
+    }
+}
+
+static void ActionAlarmCancel(clock_task_args_t args, const input_event_t * event) {
+    (void)event;
+    if (!ClockIsAlarmActive(args->clock) && args->alarm_already_set) {
+        ClockAlarmEnable(args->clock, false);
+        ShowAnimation(&ALARM_OFF_BANNER, BANNER_TIME_MS, args);
+    } else {
+        DisplayStop(args->board->display);
+        ClockActivateAlarm(args->clock, false);
+    }
+}
+
+static void ActionCancelTime(clock_task_args_t args, const input_event_t * event) {
+    clock_time_t time;
+
+    (void)event;
+    ChangeMode(ClockGetTime(args->clock, &time) ? SHOW_TIME : UNSET_TIME, args);
+}
+
+static void ActionSaveTime(clock_task_args_t args, const input_event_t * event) {
+    uint8_t digits[HOUR_MINUTE_DIGITS];
+    clock_time_t time;
+
+    (void)event;
+    HourAndMinuteToBCD(args->hour, args->minute, digits);
+    BCDToClockTime(&time, digits);
+    ClockSetTime(args->clock, &time);
+}
+
+static void ActionSaveAlarm(clock_task_args_t args, const input_event_t * event) {
+    uint8_t digits[HOUR_MINUTE_DIGITS];
+    clock_time_t time;
+
+    (void)event;
+    HourAndMinuteToBCD(args->hour, args->minute, digits);
+    BCDToClockTime(&time, digits);
+    ClockSetAlarm(args->clock, &time);
+    args->alarm_already_set = true;
+}
+
+static void AnimationDone(display_t display, void * context) {
+    input_event_t event = {
+        .timestamp = xTaskGetTickCount() * portTICK_PERIOD_MS,
+        .source = INPUT_SOURCE_DISPLAY,
+        .kind = INPUT_ANIMATION_DONE,
+    };
+    (void)display;
+    // Se llama desde el objeto de refresco, así que el evento se atiende cuando termine el refresco
+    ActivePost((active_t)context, &event);
+}
+
+static void ShowAnimation(display_animation_t animation, uint32_t frame_ms, clock_task_args_t args) {
+    args->animation = *animation;
+    args->animation.duration = DisplayScanMsToSweeps(args->scan, frame_ms);
+    DisplayPlay(args->board->display, &args->animation, AnimationDone, args->self);
+}
+
+static void ChangeMode(mode_t value, clock_task_args_t args) {
+    const struct clock_mode_s * mode = &MODES[value];
+    display_t display = args->board->display;
+    uint16_t flash_sweeps = DisplayScanMsToSweeps(args->scan, FLASH_TIME_ON_MS);
+
+    PROFILE_BEGIN(PROFILE_CHANGE_MODE);
     args->current_mode = value;
-    if (xSemaphoreTake(args->display_mutex, portMAX_DELAY)) {
-        switch (args->current_mode) {
-        case UNSET_TIME:
-            DisplayFlashDigits(args->board->display, 0, 3, FLASH_FREQUENCY);
-            DisplayFlashPoint(args->board->display, 0b00000010, FLASH_FREQUENCY);
-            DisplaySetPoint(args->board->display, 0, false);
-            DisplaySetPoint(args->board->display, 2, false);
-            DisplaySetPoint(args->board->display, 3, false);
-            break;
-        case SHOW_TIME:
-            DisplayFlashDigits(args->board->display, 0, 0, 0);
-            DisplaySetPoint(args->board->display, 2, false);
-            break;
-        case SET_TIME_MINUTE:
-            DisplayFlashDigits(args->board->display, 2, 3, FLASH_FREQUENCY);
-            DisplayFlashPoint(args->board->display, 0b00001111, 0);
-            DisplaySetPoint(args->board->display, 0, false);
-            DisplaySetPoint(args->board->display, 1, false);
-            DisplaySetPoint(args->board->display, 2, false);
-            DisplaySetPoint(args->board->display, 3, false);
-            break;
-        case SET_TIME_HOUR:
-            DisplayFlashDigits(args->board->display, 0, 1, FLASH_FREQUENCY);
-            DisplayFlashPoint(args->board->display, 0b00001111, 0);
-            DisplaySetPoint(args->board->display, 0, false);
-            DisplaySetPoint(args->board->display, 1, false);
-            DisplaySetPoint(args->board->display, 2, false);
-            DisplaySetPoint(args->board->display, 3, false);
-            break;
-        case SET_ALARM_MINUTE:
-            DisplayFlashDigits(args->board->display, 2, 3, FLASH_FREQUENCY);
-            DisplaySetPoint(args->board->display, 0, true);
-            DisplaySetPoint(args->board->display, 1, true);
-            DisplaySetPoint(args->board->display, 2, true);
-            DisplaySetPoint(args->board->display, 3, true);
-            break;
-        case SET_ALARM_HOUR:
-            DisplayFlashDigits(args->board->display, 0, 1, FLASH_FREQUENCY);
-            DisplaySetPoint(args->board->display, 0, true);
-            DisplaySetPoint(args->board->display, 1, true);
-            DisplaySetPoint(args->board->display, 2, true);
-            DisplaySetPoint(args->board->display, 3, true);
-            break;
-        default:
-            break;
+    DisplayStop(display);
+    for (uint8_t digit = 0; digit < DisplayDigits(display); digit++) {
+        if (digit >= HOUR_MINUTE_DIGITS) {
+            DisplaySetPoint(display, digit, false);
+        } else if (mode->point_mask & (1 << digit)) {
+            DisplaySetPoint(display, digit, mode->points & (1 << digit));
         }
-        xSemaphoreGive(args->display_mutex);
     }
+    DisplayFlashDigits(display, mode->flash_from, mode->flash_to, mode->flash ? flash_sweeps : 0);
+    DisplayFlashPoint(display, mode->flash_point, mode->flash_point ? flash_sweeps : 0);
+    if (mode->separators && DisplayDigits(display) == HOUR_MINUTE_DIGITS) {
+        DisplaySetPointEffect(display, 1, DisplayScanMsToSweeps(args->scan, POINT_BLINK_PERIOD), 0);
+    } else if (mode->separators && DisplayDigits(display) == TIME_DIGITS) {
+        // Sin guiones los puntos separan las horas, los minutos y los segundos
+        DisplaySetPoint(display, 1, true);
+        DisplaySetPoint(display, 3, true);
+    }
+    PROFILE_END(PROFILE_CHANGE_MODE);
 }
 
 /* === Public function implementation ========================================================= */
-void ClockTask(void * pointer) {
-    clock_task_args_t args = (clock_task_args_t)pointer;
-    EventBits_t clock_events;
-
-    static uint8_t hour[2] = {0};
-    static uint8_t minute[2] = {0};
-    static uint8_t digits[4] = {0};
-    static clock_time_t time = {0};
-    bool alarm_already_set = false;
-    static bool point_state_show_time = false;
-
-    args->current_mode = UNSET_TIME;
+void ClockStart(clock_task_args_t args) {
     ChangeMode(UNSET_TIME, args);
+    MODES[UNSET_TIME].view(args, NULL);
+}
 
-    while (true) {
+uint8_t ClockViewChanges(clock_task_args_t args) {
+    uint8_t changes = CLOCK_CHANGED_MINUTES | CLOCK_CHANGED_ALARM;
 
-        xEventGroupClearBits(args->clock_events, ANY_EVENT);
+    if (DisplayDigits(args->board->display) > HOUR_MINUTE_DIGITS) {
+        changes |= CLOCK_CHANGED_SECONDS;
+    }
+    return changes;
+}
 
-        clock_events = xEventGroupWaitBits(args->clock_events, ANY_EVENT, pdTRUE, pdFALSE, pdMS_TO_TICKS(100));
-        if (clock_events &
-            (BUTTON_EVENT_0 | BUTTON_EVENT_1 | BUTTON_EVENT_2 | BUTTON_EVENT_3 | BUTTON_EVENT_4 | BUTTON_EVENT_5)) {
-            xEventGroupSetBits(args->clock_events, TICKS_EVENTS_8);
-        }
-        switch (args->current_mode) {
-        case UNSET_TIME:
-            if (xSemaphoreTake(args->display_mutex, pdMS_TO_TICKS(100))) {
-                ClockGetTime(args->clock, &time);
-                ClockTimeToBCD(&time, digits);
-                BCDtoHourAndMinute(hour, minute, digits);
-                DisplayWrite(args->board->display, digits, sizeof(digits));
-                xSemaphoreGive(args->display_mutex);
-            }
-            if (clock_events & BUTTON_EVENT_4) {
-                ChangeMode(SET_TIME_MINUTE, args);
-            }
-            break;
-        case SHOW_TIME:
-            if (xSemaphoreTake(args->display_mutex, pdMS_TO_TICKS(100))) {
-                ClockGetTime(args->clock, &time);
-                ClockTimeToBCD(&time, digits);
-                BCDtoHourAndMinute(hour, minute, digits);
-                DisplayWrite(args->board->display, digits, sizeof(digits));
-                DisplaySetPoint(args->board->display, 0, ClockIsAlarmActive(args->clock));
-                DisplaySetPoint(args->board->display, 3, ClockIsAlarmEnabled(args->clock));
-                if (clock_events & TICKS_EVENTS_6) {
-                    point_state_show_time = !point_state_show_time;
-                    DisplaySetPoint(args->board->display, 1, point_state_show_time);
-                }
-                xSemaphoreGive(args->display_mutex);
-            }
-
-            if (clock_events & BUTTON_EVENT_4) {
-                ChangeMode(SET_TIME_MINUTE, args);
-            }
-            if (clock_events & BUTTON_EVENT_5) {
-                if (xSemaphoreTake(args->display_mutex, pdMS_TO_TICKS(100))) {
-                    ClockGetAlarm(args->clock, &time);
-                    ClockTimeToBCD(&time, digits);
-                    BCDtoHourAndMinute(hour, minute, digits);
-                    HourAndMinuteToBCD(hour, minute, digits);
-                    DisplayWrite(args->board->display, digits, sizeof(digits));
-                    xSemaphoreGive(args->display_mutex);
-                }
-                ChangeMode(SET_ALARM_MINUTE, args);
-            }
-            if (!ClockIsAlarmActive(args->clock) && alarm_already_set) { // Solamente puedo habilitar y deshabilitar la
-                                                                         // alarma cuando ya se la seteo por primera vez
-                if (clock_events & BUTTON_EVENT_0) {                     // Aceptar
-                    ClockAlarmEnable(args->clock, true);
-                }
-                if (clock_events & BUTTON_EVENT_1) { // cancelar
-                    ClockAlarmEnable(args->clock, false);
-                }
-            } else {
-                if (clock_events & BUTTON_EVENT_0) {
-                    ClockPostponeAlarm(args->clock);
-                }
-                if (clock_events & BUTTON_EVENT_1) {
-                    ClockActivateAlarm(args->clock, false);
-                }
-            }
-            break;
-
-        case SET_TIME_MINUTE:
-            if (xSemaphoreTake(args->display_mutex, pdMS_TO_TICKS(100))) {
-                HourAndMinuteToBCD(hour, minute, digits);
-                DisplayWrite(args->board->display, digits, sizeof(digits));
-                xSemaphoreGive(args->display_mutex);
-            }
-            if (clock_events & BUTTON_EVENT_2) { // Incrementar
-                BCDIncrement(minute, MINUTE_LIMIT);
-            }
-            if (clock_events & BUTTON_EVENT_3) { // Decrementar
-                BCDDecrement(minute, MINUTE_LIMIT);
-            }
-            if (clock_events & BUTTON_EVENT_0) { // Aceptar
-                ChangeMode(SET_TIME_HOUR, args);
-            }
-            if (clock_events & (BUTTON_EVENT_1 | TICKS_EVENTS_7)) { // cancelar
-                if (ClockGetTime(args->clock, &time)) {
-                    ChangeMode(SHOW_TIME, args);
-                } else {
-                    ChangeMode(UNSET_TIME, args);
-                }
-            }
-
-            break;
-        case SET_TIME_HOUR:
-            if (xSemaphoreTake(args->display_mutex, pdMS_TO_TICKS(100))) {
-                HourAndMinuteToBCD(hour, minute, digits);
-                DisplayWrite(args->board->display, digits, sizeof(digits));
-                xSemaphoreGive(args->display_mutex);
-            }
-            if (clock_events & BUTTON_EVENT_2) { // Incrementar
-                BCDIncrement(hour, HOUR_LIMIT);
-            }
-            if (clock_events & BUTTON_EVENT_3) { // Decrementar
-                BCDDecrement(hour, HOUR_LIMIT);
-            }
-            if (clock_events & BUTTON_EVENT_0) { // Aceptar
-                if (xSemaphoreTake(args->display_mutex, pdMS_TO_TICKS(100))) {
-                    HourAndMinuteToBCD(hour, minute, digits);
-                    BCDToClockTime(&time, digits);
-                    ClockSetTime(args->clock, &time);
-                    xSemaphoreGive(args->display_mutex);
-                }
-                ChangeMode(SHOW_TIME, args);
-            }
-            if (clock_events & (BUTTON_EVENT_1 | TICKS_EVENTS_7)) { // cancelar
-                if (ClockGetTime(args->clock, &time)) {
-                    ChangeMode(SHOW_TIME, args);
-                } else {
-                    ChangeMode(UNSET_TIME, args);
-                }
-            }
-
-            break;
-        case SET_ALARM_MINUTE:
-            if (xSemaphoreTake(args->display_mutex, pdMS_TO_TICKS(100))) {
-                HourAndMinuteToBCD(hour, minute, digits);
-                DisplayWrite(args->board->display, digits, sizeof(digits));
-                xSemaphoreGive(args->display_mutex);
-            }
-            if (clock_events & BUTTON_EVENT_2) { // Incrementar
-                BCDIncrement(minute, MINUTE_LIMIT);
-            }
-            if (clock_events & BUTTON_EVENT_3) { // Decrementar
-                BCDDecrement(minute, MINUTE_LIMIT);
-            }
-            if (clock_events & BUTTON_EVENT_0) { // Aceptar
-                ChangeMode(SET_ALARM_HOUR, args);
-            }
-            if (clock_events & (BUTTON_EVENT_1 | TICKS_EVENTS_7)) { // cancelar
-                ChangeMode(SHOW_TIME, args);
-            }
-
-            break;
-        case SET_ALARM_HOUR:
-            if (xSemaphoreTake(args->display_mutex, pdMS_TO_TICKS(100))) {
-                HourAndMinuteToBCD(hour, minute, digits);
-                DisplayWrite(args->board->display, digits, sizeof(digits));
-                xSemaphoreGive(args->display_mutex);
-            }
-            if (clock_events & BUTTON_EVENT_2) { // Incrementar
-                BCDIncrement(hour, HOUR_LIMIT);
-            }
-            if (clock_events & BUTTON_EVENT_3) { // Decrementar
-                BCDDecrement(hour, HOUR_LIMIT);
-            }
-            if (clock_events & BUTTON_EVENT_0) { // Aceptar
-                if (xSemaphoreTake(args->display_mutex, pdMS_TO_TICKS(100))) {
-                    HourAndMinuteToBCD(hour, minute, digits);
-                    BCDToClockTime(&time, digits);
-                    ClockSetAlarm(args->clock, &time);
-                    xSemaphoreGive(args->display_mutex);
-                }
-                alarm_already_set = true;
-                ChangeMode(SHOW_TIME, args);
-            }
-            if (clock_events & (BUTTON_EVENT_1 | TICKS_EVENTS_7)) { // cancelar
-                ChangeMode(SHOW_TIME, args);
-            }
-
-            break;
-        }
+void TimekeeperHandler(const input_event_t * event, void * context) {
+    timekeeper_args_t args = (timekeeper_args_t)context;
+    uint32_t now = args->counter();
+    uint32_t deadlines[POWER_DEADLINES] = {
+        [POWER_DEADLINE_ALARM] = POWER_NO_DEADLINE,
+        [POWER_DEADLINE_BLINK] = POWER_NO_DEADLINE,
+        [POWER_DEADLINE_INACTIVITY] = POWER_NO_DEADLINE,
+        [POWER_DEADLINE_ROLLOVER] = POWER_NO_DEADLINE,
+    };
+    input_event_t changed = {
+        .timestamp = now,
+        .source = INPUT_SOURCE_TIMER,
+        .kind = INPUT_CLOCK_CHANGED,
+    };
+
+    (void)event;
+    PROFILE_BEGIN(PROFILE_CLOCK_SYNC);
+    ClockSync(args->clock, now);
+    PROFILE_END(PROFILE_CLOCK_SYNC);
+    changed.other = ClockTakeChanges(args->clock) & args->changes;
+    if (changed.other) {
+        ActivePost(args->target, &changed);
+    }
+    // El reloj cuenta un tick por milisegundo, así que sus ticks ya son milisegundos
+    deadlines[POWER_DEADLINE_ALARM] = ClockTicksToChange(args->clock, CLOCK_CHANGED_ALARM);
+    deadlines[POWER_DEADLINE_ROLLOVER] =
+        ClockTicksToChange(args->clock, args->changes & (CLOCK_CHANGED_SECONDS | CLOCK_CHANGED_MINUTES));
+    ActiveTimerStart(args->timer, PowerPlanSleep(deadlines), 0);
+}
+
+void ClockHandler(const input_event_t * event, void * context) {
+    clock_task_args_t args = (clock_task_args_t)context;
+    // Los eventos se procesan de a uno, así ninguna pulsación se pierde aunque lleguen varias seguidas
+    const struct clock_transition_s * transition = &TRANSITIONS[args->current_mode][EventSignal(event)];
+    input_event_t activity = {
+        .timestamp = event->timestamp,
+        .source = event->source,
+        .kind = INPUT_ACTIVITY,
+    };
+    input_event_t sync = {
+        .timestamp = event->timestamp,
+        .source = INPUT_SOURCE_TIMER,
+        .kind = INPUT_CLOCK_SYNC,
+    };
+
+    if (event->source == INPUT_SOURCE_KEY || event->source == INPUT_SOURCE_ENCODER) {
+        ActivePost(args->display, &activity);
+    }
+    MODES[args->current_mode].view(args, event);
+    if (ACTIONS[transition->action]) {
+        ACTIONS[transition->action](args, event);
+    }
+    if (transition->next != STAY) {
+        ChangeMode(transition->next - 1, args);
+    }
+    // Sin un redibujo periódico, la pantalla se actualiza al terminar cada evento
+    MODES[args->current_mode].view(args, event);
+    if (event->kind == INPUT_CLOCK_CHANGED) {
+        ActivePost(args->display, event);
+    } else if (event->source == INPUT_SOURCE_KEY || event->source == INPUT_SOURCE_ENCODER) {
+        ActivePost(args->timekeeper, &sync);
     }
 }
 
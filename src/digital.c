@@ -22,11 +22,17 @@ SPDX-License-Identifier: MIT
  **/
 
 /* === Headers files inclusions ==================================================================================== */
-#include <stdlib.h>
+#include <string.h>
 #include "digital.h"
+#include "config.h"
 #include "chip.h"
 
 /* === Macros definitions ========================================================================================== */
+#define POOL_REPORT_STRING(value) #value
+#define POOL_REPORT(value)        POOL_REPORT_STRING(value)
+
+#pragma message("Pools de digital: " POOL_REPORT(DIGITAL_OUTPUTS_POOL_SIZE) " salidas, " POOL_REPORT(                \
+    DIGITAL_INPUTS_POOL_SIZE) " entradas, " POOL_REPORT(DIGITAL_GROUPS_POOL_SIZE) " grupos de cada tipo")
 
 /* === Private data type declarations ============================================================================== */
 
@@ -42,24 +48,113 @@ struct digital_input_s {
     bool lastState;
 };
 
+//! Puerto que se escribe en un grupo de salidas
+struct digital_output_port_s {
+    uint8_t gpio;  //!< Numero de puerto
+    uint32_t mask; //!< Bits del puerto que pertenecen al grupo
+};
+
+struct digital_output_group_s {
+    uint8_t ports;
+    uint8_t count;
+    struct digital_output_port_s port[DIGITAL_GROUP_MAX_PORTS];
+    uint8_t port_of[DIGITAL_GROUP_MAX_OUTPUTS]; //!< Puerto de cada salida en el arreglo port
+    uint32_t bit_of[DIGITAL_GROUP_MAX_OUTPUTS]; //!< Máscara del bit del puerto de cada salida
+};
+
+//! Puerto que se lee en un grupo de entradas
+struct digital_group_port_s {
+    uint8_t gpio;      //!< Numero de puerto
+    uint32_t inverted; //!< Bits del puerto con lógica inversa
+};
+
+struct digital_input_group_s {
+    uint8_t ports;
+    uint8_t count;
+    struct digital_group_port_s port[DIGITAL_GROUP_MAX_PORTS];
+    uint8_t port_of[DIGITAL_GROUP_MAX_INPUTS]; //!< Puerto de cada entrada en el arreglo port
+    uint8_t bit_of[DIGITAL_GROUP_MAX_INPUTS];  //!< Bit del puerto de cada entrada
+    uint16_t lastState;
+};
+
 /* === Private function declarations =============================================================================== */
+/**
+ * @brief Calcula la máscara de cada puerto para un conjunto de salidas del grupo
+ *
+ * @param self Referencia al grupo
+ * @param outputs Salidas, un bit por salida
+ * @param masks Arreglo donde se guarda la máscara de cada puerto
+ */
+static void DigitalOutputGroupMasks(digital_output_group_t self, uint16_t outputs, uint32_t masks[]);
+
+/**
+ * @brief Lee los puertos del grupo y junta el estado de las entradas en un bit cada una
+ *
+ * @param self Referencia al grupo
+ * @return uint16_t Entradas activas
+ */
+static uint16_t DigitalInputGroupGetActive(digital_input_group_t self);
 
 /* === Private variable definitions ================================================================================ */
+static struct digital_output_s outputs_pool[DIGITAL_OUTPUTS_POOL_SIZE];
+static uint8_t outputs_used;
+
+static struct digital_input_s inputs_pool[DIGITAL_INPUTS_POOL_SIZE];
+static uint8_t inputs_used;
+
+static struct digital_output_group_s output_groups_pool[DIGITAL_GROUPS_POOL_SIZE];
+static uint8_t output_groups_used;
+
+static struct digital_input_group_s input_groups_pool[DIGITAL_GROUPS_POOL_SIZE];
+static uint8_t input_groups_used;
+
+_Static_assert(sizeof(outputs_pool) + sizeof(inputs_pool) + sizeof(output_groups_pool) + sizeof(input_groups_pool) <=
+                   DIGITAL_RAM,
+               "DIGITAL_RAM no alcanza para los pools");
 
 /* === Public variable definitions ================================================================================= */
 
 /* === Private function definitions ================================================================================ */
+static void DigitalOutputGroupMasks(digital_output_group_t self, uint16_t outputs, uint32_t masks[]) {
+    if ((outputs & DIGITAL_GROUP_ALL) == DIGITAL_GROUP_ALL) {
+        // El caso más común ya está calculado desde la creación del grupo
+        for (uint8_t index = 0; index < self->ports; index++) {
+            masks[index] = self->port[index].mask;
+        }
+        return;
+    }
+    memset(masks, 0, sizeof(uint32_t) * self->ports);
+    for (uint8_t output = 0; output < self->count; output++) {
+        if (outputs & (1U << output)) {
+            masks[self->port_of[output]] |= self->bit_of[output];
+        }
+    }
+}
+
+static uint16_t DigitalInputGroupGetActive(digital_input_group_t self) {
+    uint32_t values[DIGITAL_GROUP_MAX_PORTS];
+    uint16_t active = 0;
+
+    for (uint8_t index = 0; index < self->ports; index++) {
+        values[index] = Chip_GPIO_ReadValue(LPC_GPIO_PORT, self->port[index].gpio) ^ self->port[index].inverted;
+    }
+    for (uint8_t input = 0; input < self->count; input++) {
+        active |= ((values[self->port_of[input]] >> self->bit_of[input]) & 1U) << input;
+    }
+    return active;
+}
 
 /* === Public function implementation ============================================================================== */
 
 digital_output_t DigitalOutputCreate(uint8_t gpio, uint8_t bit) {
-    digital_output_t self = malloc(sizeof(struct digital_output_s));
-    if (self != NULL) {
+    digital_output_t self = NULL;
+    if (outputs_used < DIGITAL_OUTPUTS_POOL_SIZE) {
+        self = &outputs_pool[outputs_used++];
         self->gpio = gpio;
         self->bit = bit;
+        DigitalOutputDeactivate(self);
+        Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, self->gpio, self->bit, true);
     }
-    DigitalOutputDeactivate(self);
-    Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, self->gpio, self->bit, true);
     return self;
 }
 
@@ -75,15 +170,88 @@ void DigitalOutputToggle(digital_output_t self) {
     Chip_GPIO_SetPinToggle(LPC_GPIO_PORT, self->gpio, self->bit);
 }
 
+digital_output_group_t DigitalOutputGroupCreate(const digital_output_t outputs[], uint8_t count) {
+    digital_output_group_t self;
+    uint8_t index;
+
+    if (outputs == NULL || count == 0 || count > DIGITAL_GROUP_MAX_OUTPUTS ||
+        output_groups_used >= DIGITAL_GROUPS_POOL_SIZE) {
+        return NULL;
+    }
+    // El lugar del pool se ocupa recién cuando el grupo es válido
+    self = &output_groups_pool[output_groups_used];
+    memset(self, 0, sizeof(struct digital_output_group_s));
+    for (uint8_t output = 0; output < count; output++) {
+        if (outputs[output] == NULL) {
+            return NULL;
+        }
+        index = 0;
+        while (index < self->ports && self->port[index].gpio != outputs[output]->gpio) {
+            index++;
+        }
+        if (index == self->ports) {
+            if (self->ports == DIGITAL_GROUP_MAX_PORTS) {
+                return NULL;
+            }
+            self->port[index].gpio = outputs[output]->gpio;
+            self->ports++;
+        }
+        self->port[index].mask |= 1UL << outputs[output]->bit;
+        self->port_of[output] = index;
+        self->bit_of[output] = 1UL << outputs[output]->bit;
+    }
+    self->count = count;
+    output_groups_used++;
+    return self;
+}
+
+void DigitalOutputGroupActivate(digital_output_group_t self, uint16_t outputs) {
+    uint32_t masks[DIGITAL_GROUP_MAX_PORTS];
+
+    DigitalOutputGroupMasks(self, outputs, masks);
+    for (uint8_t index = 0; index < self->ports; index++) {
+        if (masks[index]) {
+            Chip_GPIO_SetValue(LPC_GPIO_PORT, self->port[index].gpio, masks[index]);
+        }
+    }
+}
+
+void DigitalOutputGroupDeactivate(digital_output_group_t self, uint16_t outputs) {
+    uint32_t masks[DIGITAL_GROUP_MAX_PORTS];
+
+    DigitalOutputGroupMasks(self, outputs, masks);
+    for (uint8_t index = 0; index < self->ports; index++) {
+        if (masks[index]) {
+            Chip_GPIO_ClearValue(LPC_GPIO_PORT, self->port[index].gpio, masks[index]);
+        }
+    }
+}
+
+void DigitalOutputGroupWrite(digital_output_group_t self, uint16_t active) {
+    uint32_t masks[DIGITAL_GROUP_MAX_PORTS];
+
+    DigitalOutputGroupMasks(self, active, masks);
+    for (uint8_t index = 0; index < self->ports; index++) {
+        uint32_t clear = self->port[index].mask & ~masks[index];
+        if (masks[index]) {
+            Chip_GPIO_SetValue(LPC_GPIO_PORT, self->port[index].gpio, masks[index]);
+        }
+        if (clear) {
+            Chip_GPIO_ClearValue(LPC_GPIO_PORT, self->port[index].gpio, clear);
+        }
+    }
+}
+
 digital_input_t DigitalInputCreate(uint8_t gpio, uint8_t bit, bool inverted) {
-    digital_input_t self = malloc(sizeof(struct digital_input_s));
-    if (self != NULL) {
+    digital_input_t self = NULL;
+    if (inputs_used < DIGITAL_INPUTS_POOL_SIZE) {
+        self = &inputs_pool[inputs_used++];
         self->gpio = gpio;
         self->bit = bit;
         self->inverted = inverted;
+        Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, self->gpio, self->bit, false);
         self->lastState = DigitalInputGetIsActive(self);
     }
-    Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, self->gpio, self->bit, false);
     return self;
 }
 
@@ -102,6 +270,51 @@ bool DigitalInputWasDeactivated(digital_input_t self) {
     return DIGITAL_INPUT_WAS_DEACTIVATED == DigitalInputWasChanged(self);
 }
 
+digital_input_group_t DigitalInputGroupCreate(const digital_input_t inputs[], uint8_t count) {
+    digital_input_group_t self;
+    uint8_t index;
+
+    if (inputs == NULL || count == 0 || count > DIGITAL_GROUP_MAX_INPUTS ||
+        input_groups_used >= DIGITAL_GROUPS_POOL_SIZE) {
+        return NULL;
+    }
+    self = &input_groups_pool[input_groups_used];
+    memset(self, 0, sizeof(struct digital_input_group_s));
+    for (uint8_t input = 0; input < count; input++) {
+        if (inputs[input] == NULL) {
+            return NULL;
+        }
+        index = 0;
+        while (index < self->ports && self->port[index].gpio != inputs[input]->gpio) {
+            index++;
+        }
+        if (index == self->ports) {
+            if (self->ports == DIGITAL_GROUP_MAX_PORTS) {
+                return NULL;
+            }
+            self->port[index].gpio = inputs[input]->gpio;
+            self->ports++;
+        }
+        if (inputs[input]->inverted) {
+            self->port[index].inverted |= 1UL << inputs[input]->bit;
+        }
+        self->port_of[input] = index;
+        self->bit_of[input] = inputs[input]->bit;
+    }
+    self->count = count;
+    self->lastState = DigitalInputGroupGetActive(self);
+    input_groups_used++;
+    return self;
+}
+
+uint32_t DigitalInputGroupRead(digital_input_group_t self) {
+    uint16_t active = DigitalInputGroupGetActive(self);
+    uint16_t changed = active ^ self->lastState;
+
+    self->lastState = active;
+    return ((uint32_t)changed << 16) | active;
+}
+
 digital_state_t DigitalInputWasChanged(digital_input_t self) {
     bool state = DigitalInputGetIsActive(self);
     digital_state_t result = DIGITAL_INPUT_NO_CHANGE;
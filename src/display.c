@@ -22,38 +22,44 @@ SPDX-License-Identifier: MIT
  **/
 
 /* === Headers files inclusions ==================================================================================== */
-#include <stdlib.h>
 #include <string.h>
 #include "display.h"
-#include "poncho.h"
 
 /* === Macros definitions ========================================================================================== */
-#ifndef DISPLAY_MAX_DIGITS
-#define DISPLAY_MAX_DIGITS 8
-#endif
 
 /* === Private data type declarations ============================================================================== */
 
+//! Efecto de parpadeo compartido por todos los dígitos y puntos que tienen el mismo período y fase
+struct display_effect_s {
+    uint16_t period;      //!< Duración del ciclo en barridos, 0 si el efecto está libre
+    uint16_t phase;       //!< Valor inicial del acumulador
+    uint16_t accumulator; //!< Posición dentro del ciclo, avanza una vez por barrido
+    uint8_t digits;       //!< Máscara de los dígitos que usan el efecto
+    uint8_t points;       //!< Máscara de los puntos que usan el efecto
+};
+
 struct display_s {
     uint8_t digits;
     uint8_t current_digit;
-    struct {
-        uint8_t from;
-        uint8_t to;
-        uint8_t count;
-        uint16_t frecuency;
-    } digit_flashing;
-    struct {
-        uint8_t mask;
-        uint8_t count;
-        uint16_t frecuency;
-    } point_flashing;
+    struct display_effect_s effects[DISPLAY_MAX_EFFECTS];
+    uint8_t effect_points;  //!< Puntos que tienen un efecto asignado
+    uint8_t blank_mask;     //!< Dígitos apagados en el barrido actual
+    uint8_t lit_points;     //!< Puntos encendidos en el barrido actual
+    uint8_t sweep_step;     //!< Cuánto avanzan los efectos en cada barrido
     uint8_t point_set_mask;
     display_driver_t driver;
     uint8_t value[DISPLAY_MAX_DIGITS];
+    uint8_t frame[DISPLAY_MAX_DIGITS]; //!< Último cuadro enviado a un driver de cuadros completos
+    bool frame_valid;                  //!< Indica si `frame` contiene lo que muestra el controlador externo
+    display_animation_t animation;     //!< Animación en curso, NULL si no hay ninguna
+    display_animation_done_t done;     //!< Función que se llama al terminar la animación
+    void * done_context;               //!< Argumento de la función de finalización
+    const uint8_t * animation_frame;   //!< Segmentos del cuadro que se está mostrando
+    uint16_t frame_index;              //!< Número del cuadro que se está mostrando
+    uint16_t frame_elapsed;            //!< Barridos que lleva mostrándose el cuadro
 };
 
-static const uint8_t DIGIT_MAP[10] = {
+static const uint8_t DIGIT_MAP[] = {
     SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_E | SEGMENT_F,             // 0
     SEGMENT_B | SEGMENT_C,                                                             // 1
     SEGMENT_A | SEGMENT_B | SEGMENT_D | SEGMENT_E | SEGMENT_G,                         // 2
@@ -64,79 +70,334 @@ static const uint8_t DIGIT_MAP[10] = {
     SEGMENT_A | SEGMENT_B | SEGMENT_C,                                                 // 7
     SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_E | SEGMENT_F | SEGMENT_G, // 8
     SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_F | SEGMENT_G,             // 9
-
+    0,                                                                                 // DISPLAY_BLANK
+    SEGMENT_G,                                                                         // DISPLAY_DASH
 };
 
+_Static_assert(sizeof(struct display_s) <= DISPLAY_RAM, "DISPLAY_RAM no alcanza para la pantalla");
+
 /* === Private function declarations =============================================================================== */
+/**
+ * @brief Calcula las máscaras de dígitos apagados y puntos encendidos a partir de los efectos
+ *
+ * @param self Referencia al display
+ */
+static void DisplayComposeEffects(display_t self);
+
+/**
+ * @brief Avanza los acumuladores de todos los efectos, una vez por barrido completo de la pantalla
+ *
+ * @param self Referencia al display
+ * @param sweeps Barridos que avanzan los efectos
+ */
+static void DisplayAdvanceEffects(display_t self, uint16_t sweeps);
+
+/**
+ * @brief Asigna un efecto a un conjunto de dígitos y puntos
+ *
+ * Los dígitos y puntos dejan el efecto que tenían antes. Si ya existe un efecto con el mismo período y fase se
+ * comparte, así parpadean sincronizados.
+ *
+ * @param self Referencia al display
+ * @param digits Máscara de dígitos
+ * @param points Máscara de puntos
+ * @param period Duración del ciclo en barridos, 0 para que queden fijos
+ * @param phase Desplazamiento del ciclo en barridos
+ * @param restart True si el ciclo del efecto debe comenzar de nuevo
+ * @return int Devuelve -1 si no hay efectos libres y 0 si no hubieron errores
+ */
+static int DisplayAssignEffect(display_t self, uint8_t digits, uint8_t points, uint16_t period, uint16_t phase,
+                               bool restart);
+
+/**
+ * @brief Avanza la animación en curso, una vez por barrido completo de la pantalla
+ *
+ * Al pasar el último cuadro vuelve a empezar si la animación es cíclica o termina y llama a la función de
+ * finalización.
+ *
+ * @param self Referencia al display
+ * @param sweeps Barridos que avanza la animación
+ */
+static void DisplayAdvanceAnimation(display_t self, uint16_t sweeps);
+
+/**
+ * @brief Calcula los segmentos que se deben mostrar en un dígito según el estado de los efectos
+ *
+ * @param self Referencia al display
+ * @param digit Dígito que se quiere calcular
+ * @return uint8_t Segmentos del dígito
+ */
+static uint8_t DisplayDigitSegments(display_t self, uint8_t digit);
 
 /* === Private variable definitions ================================================================================ */
 
 /* === Public variable definitions ================================================================================= */
 
 /* === Private function definitions ================================================================================ */
+static void DisplayComposeEffects(display_t self) {
+    uint8_t blank = 0;
+    uint8_t lit = 0;
+
+    for (uint8_t i = 0; i < DISPLAY_MAX_EFFECTS; i++) {
+        struct display_effect_s * effect = &self->effects[i];
+        if (effect->period == 0) {
+            continue;
+        }
+        if (effect->accumulator < (effect->period / 2)) {
+            blank |= effect->digits;
+        } else {
+            lit |= effect->points;
+        }
+    }
+    self->blank_mask = blank;
+    self->lit_points = lit | (self->point_set_mask & ~self->effect_points);
+}
+
+static void DisplayAdvanceEffects(display_t self, uint16_t sweeps) {
+    for (uint8_t i = 0; i < DISPLAY_MAX_EFFECTS; i++) {
+        struct display_effect_s * effect = &self->effects[i];
+        if (effect->period != 0) {
+            effect->accumulator = ((uint32_t)effect->accumulator + sweeps) % effect->period;
+        }
+    }
+    DisplayComposeEffects(self);
+}
+
+static int DisplayAssignEffect(display_t self, uint8_t digits, uint8_t points, uint16_t period, uint16_t phase,
+                               bool restart) {
+    struct display_effect_s * target = NULL;
+    int result = 0;
+
+    for (uint8_t i = 0; i < DISPLAY_MAX_EFFECTS; i++) {
+        struct display_effect_s * effect = &self->effects[i];
+        effect->digits &= ~digits;
+        effect->points &= ~points;
+        if (effect->digits == 0 && effect->points == 0) {
+            effect->period = 0;
+        }
+    }
+    self->effect_points &= ~points;
+
+    if (period != 0) {
+        for (uint8_t i = 0; i < DISPLAY_MAX_EFFECTS && target == NULL; i++) {
+            if (self->effects[i].period == period && self->effects[i].phase == phase) {
+                target = &self->effects[i];
+            }
+        }
+        for (uint8_t i = 0; i < DISPLAY_MAX_EFFECTS && target == NULL; i++) {
+            if (self->effects[i].period == 0) {
+                target = &self->effects[i];
+                target->period = period;
+                target->phase = phase;
+                restart = true;
+            }
+        }
+        if (target == NULL) {
+            result = -1;
+        } else {
+            target->digits |= digits;
+            target->points |= points;
+            if (restart) {
+                target->accumulator = phase;
+            }
+            self->effect_points |= points;
+        }
+    }
+
+    DisplayComposeEffects(self);
+    return result;
+}
+
+static void DisplayAdvanceAnimation(display_t self, uint16_t sweeps) {
+    display_animation_t animation = self->animation;
+    uint32_t elapsed;
+    uint16_t duration;
+
+    if (animation == NULL) {
+        return;
+    }
+    elapsed = (uint32_t)self->frame_elapsed + sweeps;
+    while (self->animation != NULL) {
+        duration = animation->durations ? animation->durations[self->frame_index] : animation->duration;
+        if (duration == 0) {
+            duration = 1;
+        }
+        if (elapsed < duration) {
+            break;
+        }
+        elapsed -= duration;
+        self->frame_index++;
+        if (self->frame_index >= animation->frames) {
+            if (!animation->loop) {
+                display_animation_done_t done = self->done;
+                self->animation = NULL;
+                // La función de finalización puede empezar otra animación, que arranca desde su primer barrido
+                elapsed = 0;
+                if (done != NULL) {
+                    done(self, self->done_context);
+                }
+                break;
+            }
+            self->frame_index = 0;
+        }
+        self->animation_frame = &animation->segments[self->frame_index * animation->stride];
+    }
+    self->frame_elapsed = (uint16_t)elapsed;
+}
+
+static uint8_t DisplayDigitSegments(display_t self, uint8_t digit) {
+    uint8_t segments = self->value[digit];
+
+    if (self->animation != NULL) {
+        return (digit < self->animation->width) ? self->animation_frame[digit] : 0;
+    }
+    if (self->blank_mask & (1 << digit)) {
+        segments = 0;
+    }
+    if (self->lit_points & (1 << digit)) {
+        segments |= SEGMENT_P;
+    }
+    return segments;
+}
 
 /* === Public function implementation ============================================================================== */
 display_t DisplayCreate(uint8_t digits, display_driver_t driver) {
-    display_t self = malloc(sizeof(struct display_s));
+    static struct display_s self[1];
     if (digits > DISPLAY_MAX_DIGITS) {
         digits = DISPLAY_MAX_DIGITS;
     }
-    if (self != NULL) {
-        self->digits = digits;
-        self->driver = driver;
-        self->current_digit = 0;
-        self->digit_flashing.count = 0;
-        self->digit_flashing.frecuency = 0;
-        self->point_set_mask = 0;
-    }
+    memset(self, 0, sizeof(struct display_s));
+    self->digits = digits;
+    self->driver = driver;
+    self->current_digit = 0;
+    self->sweep_step = 1;
+    self->frame_valid = false;
+    self->animation = NULL;
     return self;
 }
+uint8_t DisplayDigits(display_t self) {
+    return self ? self->digits : 0;
+}
+
 void DisplayWrite(display_t self, uint8_t value[], uint8_t size) {
     memset(self->value, 0, sizeof(self->value));
     if (size > self->digits) {
         size = self->digits;
     }
     for (size_t i = 0; i < size; i++) {
-        self->value[i] = DIGIT_MAP[value[i]];
+        if (value[i] < sizeof(DIGIT_MAP)) {
+            self->value[i] = DIGIT_MAP[value[i]];
+        }
     }
 }
 void DisplayRefresh(display_t self) {
     uint8_t segments;
 
+    if (self->driver->FrameFlush != NULL) {
+        self->current_digit = (self->current_digit + 1) % self->digits;
+        if (self->current_digit == 0) {
+            DisplayAdvanceEffects(self, self->sweep_step);
+            DisplayAdvanceAnimation(self, self->sweep_step);
+            DisplayFlush(self);
+        }
+        return;
+    }
+
     self->driver->DigitsTurnOff();
     self->current_digit = (self->current_digit + 1) % self->digits;
+    if (self->current_digit == 0) {
+        DisplayAdvanceEffects(self, self->sweep_step);
+        DisplayAdvanceAnimation(self, self->sweep_step);
+    }
 
-    segments = self->value[self->current_digit];
-    if (self->digit_flashing.frecuency != 0) {
-        if (self->current_digit == 0) {
-            self->digit_flashing.count = (self->digit_flashing.count + 1) % (self->digit_flashing.frecuency);
-        }
-        if (self->digit_flashing.count < (self->digit_flashing.frecuency / 2)) {
-            if ((self->current_digit >= self->digit_flashing.from) &&
-                (self->current_digit <= self->digit_flashing.to)) {
-                segments = 0;
-            }
-        }
+    segments = DisplayDigitSegments(self, self->current_digit);
+
+    self->driver->SegmentsUpdate(segments);
+    self->driver->DigitsTurnOn(self->current_digit);
+}
+
+int DisplayFlush(display_t self) {
+    uint8_t frame[DISPLAY_MAX_DIGITS];
+
+    if (!self || self->driver->FrameFlush == NULL) {
+        return -1;
     }
 
-    if (self->point_flashing.frecuency != 0) {
-        if (self->current_digit == 0) {
-            self->point_flashing.count = (self->point_flashing.count + 1) % self->point_flashing.frecuency;
-        }
-        if (self->point_flashing.count >= (self->point_flashing.frecuency / 2)) {
-            if (((1 << self->current_digit) & self->point_flashing.mask)) {
-                segments |= SEGMENT_P;
-                DisplaySetPoint(self, self->current_digit, false);
-            }
+    for (uint8_t digit = 0; digit < self->digits; digit++) {
+        frame[digit] = DisplayDigitSegments(self, digit);
+    }
+    if (self->frame_valid && memcmp(frame, self->frame, self->digits) == 0) {
+        return 0;
+    }
+
+    memcpy(self->frame, frame, self->digits);
+    self->frame_valid = true;
+    self->driver->FrameFlush(self->frame, self->digits);
+    return 1;
+}
+
+void DisplayTurnOff(display_t self) {
+    static const uint8_t blank[DISPLAY_MAX_DIGITS] = {0};
+
+    if (!self) {
+        return;
+    }
+    if (self->driver->FrameFlush != NULL) {
+        if (!self->frame_valid || memcmp(self->frame, blank, self->digits) != 0) {
+            memset(self->frame, 0, sizeof(self->frame));
+            self->frame_valid = true;
+            self->driver->FrameFlush(self->frame, self->digits);
         }
+    } else {
+        self->driver->DigitsTurnOff();
     }
+}
 
-    if ((self->point_set_mask & (1 << self->current_digit)) != 0) {
-        segments |= SEGMENT_P;
+int DisplaySetSweepStep(display_t self, uint8_t step) {
+    int result = 0;
+    if (!self || step == 0) {
+        result = -1;
+    } else {
+        self->sweep_step = step;
     }
+    return result;
+}
 
-    self->driver->SegmentsUpdate(segments);
-    self->driver->DigitsTurnOn(self->current_digit);
+int DisplayAdvance(display_t self, uint16_t sweeps) {
+    if (!self || self->driver->FrameFlush == NULL) {
+        return -1;
+    }
+    DisplayAdvanceEffects(self, sweeps);
+    DisplayAdvanceAnimation(self, sweeps);
+    return DisplayFlush(self);
+}
+
+uint16_t DisplaySweepsToChange(display_t self) {
+    uint16_t sweeps = DISPLAY_NO_CHANGE;
+    uint16_t wait;
+
+    if (!self) {
+        return DISPLAY_NO_CHANGE;
+    }
+    for (uint8_t i = 0; i < DISPLAY_MAX_EFFECTS; i++) {
+        struct display_effect_s * effect = &self->effects[i];
+        if (effect->period == 0) {
+            continue;
+        }
+        // El efecto cambia al llegar a la mitad del período y al volver a empezar
+        if (effect->accumulator < effect->period / 2) {
+            wait = effect->period / 2 - effect->accumulator;
+        } else {
+            wait = effect->period - effect->accumulator;
+        }
+        sweeps = (wait < sweeps) ? wait : sweeps;
+    }
+    if (self->animation != NULL) {
+        wait = self->animation->durations ? self->animation->durations[self->frame_index] : self->animation->duration;
+        wait = (wait > self->frame_elapsed) ? wait - self->frame_elapsed : 1;
+        sweeps = (wait < sweeps) ? wait : sweeps;
+    }
+    return sweeps;
 }
 
 int DisplayFlashDigits(display_t self, uint8_t from, uint8_t to, uint16_t time_on) {
@@ -146,10 +407,9 @@ int DisplayFlashDigits(display_t self, uint8_t from, uint8_t to, uint16_t time_o
     } else if (!self) {
         result = -1;
     } else {
-        self->digit_flashing.from = from;
-        self->digit_flashing.to = to;
-        self->digit_flashing.frecuency = 2 * time_on;
-        self->digit_flashing.count = 0;
+        uint8_t range = (uint8_t)(((1 << (to + 1)) - 1) & ~((1 << from) - 1));
+        DisplayAssignEffect(self, 0xFF, 0, 0, 0, false);
+        result = DisplayAssignEffect(self, range, 0, 2 * time_on, 0, true);
     }
     return result;
 }
@@ -158,9 +418,28 @@ int DisplayFlashPoint(display_t self, uint8_t mask, uint16_t time_on) {
     if (!self) {
         result = -1;
     } else {
-        self->point_flashing.mask = mask;
-        self->point_flashing.frecuency = 2 * time_on;
-        self->point_flashing.count = 0;
+        DisplayAssignEffect(self, 0, 0xFF, 0, 0, false);
+        result = DisplayAssignEffect(self, 0, mask, 2 * time_on, 0, true);
+    }
+    return result;
+}
+
+int DisplaySetDigitEffect(display_t self, uint8_t digit, uint16_t period, uint16_t phase) {
+    int result = 0;
+    if (!self || digit >= self->digits || (period != 0 && phase >= period)) {
+        result = -1;
+    } else {
+        result = DisplayAssignEffect(self, 1 << digit, 0, period, phase, false);
+    }
+    return result;
+}
+
+int DisplaySetPointEffect(display_t self, uint8_t digit, uint16_t period, uint16_t phase) {
+    int result = 0;
+    if (!self || digit >= self->digits || (period != 0 && phase >= period)) {
+        result = -1;
+    } else {
+        result = DisplayAssignEffect(self, 0, 1 << digit, period, phase, false);
     }
     return result;
 }
@@ -169,13 +448,42 @@ int DisplaySetPoint(display_t self, uint8_t digit, bool on) {
     int result = 0;
     if (!self || digit >= self->digits) {
         result = -1;
+    } else {
+        if (on) {
+            self->point_set_mask |= (1 << digit);
+        } else {
+            self->point_set_mask &= ~(1 << digit);
+        }
+        DisplayComposeEffects(self);
     }
-    if (on) {
-        self->point_set_mask |= (1 << digit);
+    return result;
+}
+
+int DisplayPlay(display_t self, display_animation_t animation, display_animation_done_t done, void * context) {
+    int result = 0;
+    if (!self || !animation || !animation->segments || animation->frames == 0 || animation->width == 0) {
+        result = -1;
+    } else if (animation->durations == NULL && animation->duration == 0) {
+        result = -1;
     } else {
-        self->point_set_mask &= ~(1 << digit);
+        self->done = done;
+        self->done_context = context;
+        self->frame_index = 0;
+        self->frame_elapsed = 0;
+        self->animation_frame = animation->segments;
+        self->animation = animation;
     }
     return result;
 }
 
+void DisplayStop(display_t self) {
+    if (self) {
+        self->animation = NULL;
+    }
+}
+
+bool DisplayIsPlaying(display_t self) {
+    return self && self->animation != NULL;
+}
+
 /* === End of documentation ======================================================================================== */
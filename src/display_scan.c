@@ -0,0 +1,201 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, María Ayelén Vega Caro <ayelenvegacaro@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file  display_scan.c
+ ** @brief Planificador de la frecuencia de barrido de la pantalla
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+#include "display_scan.h"
+#include <stddef.h>
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+#define MS_PER_SECOND 1000
+
+/* === Private data type declarations ============================================================================== */
+//! Estructura que define al planificador
+struct display_scan_s {
+    display_scan_config_t config;
+    uint8_t digits;
+    uint8_t brightness;
+    uint16_t active_period;   //!< Milisegundos entre refrescos de dígito a frecuencia completa
+    display_scan_state_t state;
+    uint32_t inactive_ms;
+    uint32_t window_ms;       //!< Tiempo acumulado en el segundo que se está midiendo
+    uint16_t window_wakeups;  //!< Despertares en el segundo que se está midiendo
+    uint16_t wakeups_per_second;
+};
+
+_Static_assert(sizeof(struct display_scan_s) <= DISPLAY_SCAN_RAM, "DISPLAY_SCAN_RAM no alcanza para el planificador");
+
+/* === Private function declarations =============================================================================== */
+/**
+ * @brief Calcula el período más largo que mantiene la frecuencia sin parpadeo para el brillo actual
+ *
+ * @param self Referencia al planificador
+ */
+static void DisplayScanUpdatePeriod(display_scan_t self);
+
+/* === Private variable definitions ================================================================================ */
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+static void DisplayScanUpdatePeriod(display_scan_t self) {
+    uint32_t steps_per_second = (uint32_t)self->config->flicker_free_hz[self->brightness] * self->digits;
+
+    // Se redondea hacia abajo para no quedar por debajo de la frecuencia mínima
+    self->active_period = 1;
+    if (steps_per_second != 0 && (MS_PER_SECOND / steps_per_second) > 1) {
+        self->active_period = (uint16_t)(MS_PER_SECOND / steps_per_second);
+    }
+}
+
+/* === Public function implementation ============================================================================== */
+display_scan_t DisplayScanCreate(display_scan_config_t config, uint8_t digits, uint8_t brightness) {
+    static struct display_scan_s self[1];
+
+    if (config == NULL || digits == 0 || brightness >= DISPLAY_SCAN_BRIGHTNESS_LEVELS) {
+        return NULL;
+    }
+    memset(self, 0, sizeof(struct display_scan_s));
+    self->config = config;
+    self->digits = digits;
+    self->brightness = brightness;
+    self->state = DISPLAY_SCAN_ACTIVE;
+    DisplayScanUpdatePeriod(self);
+    return self;
+}
+
+int DisplayScanSetBrightness(display_scan_t self, uint8_t brightness) {
+    if (!self || brightness >= DISPLAY_SCAN_BRIGHTNESS_LEVELS) {
+        return -1;
+    }
+    self->brightness = brightness;
+    DisplayScanUpdatePeriod(self);
+    return 0;
+}
+
+void DisplayScanActivity(display_scan_t self) {
+    if (self) {
+        self->inactive_ms = 0;
+        self->state = DISPLAY_SCAN_ACTIVE;
+    }
+}
+
+display_scan_state_t DisplayScanElapsed(display_scan_t self, uint32_t elapsed_ms) {
+    if (!self) {
+        return DISPLAY_SCAN_ACTIVE;
+    }
+
+    self->window_wakeups++;
+    self->window_ms += elapsed_ms;
+    if (self->window_ms >= MS_PER_SECOND) {
+        self->wakeups_per_second = self->window_wakeups;
+        self->window_wakeups = 0;
+        self->window_ms -= MS_PER_SECOND;
+    }
+
+    self->inactive_ms += elapsed_ms;
+    if (self->config->blank_timeout_ms != 0 && self->inactive_ms >= self->config->blank_timeout_ms) {
+        self->state = DISPLAY_SCAN_BLANK;
+    } else if (self->config->idle_timeout_ms != 0 && self->inactive_ms >= self->config->idle_timeout_ms) {
+        self->state = DISPLAY_SCAN_IDLE;
+    } else {
+        self->state = DISPLAY_SCAN_ACTIVE;
+    }
+    return self->state;
+}
+
+display_scan_state_t DisplayScanState(display_scan_t self) {
+    return self ? self->state : DISPLAY_SCAN_ACTIVE;
+}
+
+uint16_t DisplayScanPeriod(display_scan_t self) {
+    uint16_t period = 1;
+
+    if (self) {
+        switch (self->state) {
+        case DISPLAY_SCAN_BLANK:
+            period = self->config->blank_period_ms;
+            break;
+        case DISPLAY_SCAN_IDLE:
+            period = self->active_period * DisplayScanSweepStep(self);
+            break;
+        default:
+            period = self->active_period;
+            break;
+        }
+    }
+    return period;
+}
+
+uint16_t DisplayScanRefreshRate(display_scan_t self) {
+    uint16_t rate = 0;
+    if (self) {
+        rate = (uint16_t)(MS_PER_SECOND / ((uint32_t)self->active_period * self->digits));
+    }
+    return rate;
+}
+
+uint8_t DisplayScanSweepStep(display_scan_t self) {
+    uint8_t step = 1;
+    if (self && self->state == DISPLAY_SCAN_IDLE && self->config->idle_divider > 1) {
+        step = self->config->idle_divider;
+    }
+    return step;
+}
+
+uint16_t DisplayScanMsToSweeps(display_scan_t self, uint32_t ms) {
+    uint32_t sweeps = 1;
+    if (self) {
+        sweeps = ms / ((uint32_t)self->active_period * self->digits);
+        if (sweeps == 0) {
+            sweeps = 1;
+        }
+    }
+    return (uint16_t)sweeps;
+}
+
+uint32_t DisplayScanSweepsToMs(display_scan_t self, uint32_t sweeps) {
+    return self ? sweeps * self->active_period * self->digits : sweeps;
+}
+
+uint32_t DisplayScanMsToNextState(display_scan_t self) {
+    uint32_t ms = DISPLAY_SCAN_NO_DEADLINE;
+
+    if (!self) {
+        return DISPLAY_SCAN_NO_DEADLINE;
+    }
+    if (self->config->blank_timeout_ms != 0 && self->inactive_ms < self->config->blank_timeout_ms) {
+        ms = self->config->blank_timeout_ms - self->inactive_ms;
+    }
+    if (self->config->idle_timeout_ms != 0 && self->inactive_ms < self->config->idle_timeout_ms &&
+        self->config->idle_timeout_ms - self->inactive_ms < ms) {
+        ms = self->config->idle_timeout_ms - self->inactive_ms;
+    }
+    return ms;
+}
+
+uint16_t DisplayScanWakeupsPerSecond(display_scan_t self) {
+    return self ? self->wakeups_per_second : 0;
+}
+
+/* === End of documentation ======================================================================================== */
@@ -23,53 +23,157 @@ SPDX-License-Identifier: MIT
 
 /* === Headers files inclusions =============================================================== */
 #include "display_tasks.h"
+#include "config.h"
+#include "power.h"
+#include "profile.h"
+#include "trace.h"
 #include <stdint.h>
 
 /* === Macros definitions ====================================================================== */
-#define INACTIVITY_COUNT 30000 ///< Tiempo maximo de inactividad en ms
+//! Con el MAX7219 la imagen se mantiene sola, así que solamente se despierta para cambiarla y no con cada barrido
+#define FRAME_DRIVEN BOARD_DISPLAY_MAX7219
 
 /* === Private data type declarations ========================================================== */
 
 /* === Private variable declarations =========================================================== */
 
 /* === Private function declarations =========================================================== */
+/**
+ * @brief Vuelve a arrancar el temporizador del refresco si el planificador de barrido cambió el período
+ *
+ * @param args Argumentos del objeto
+ * @param delay Tiempo en ms hasta el próximo refresco si hay que volver a arrancarlo
+ */
+static void UpdatePeriod(refresh_task_args_t args, uint32_t delay);
+
+/**
+ * @brief Programa el próximo refresco en el vencimiento más cercano en lugar de refrescar periódicamente
+ *
+ * La hora y la alarma no se planifican acá: el objeto que lleva la hora se despierta para ellas y el reloj reenvía el
+ * cambio ya dibujado.
+ *
+ * @param args Argumentos del objeto
+ * @param state Estado en que quedó la pantalla
+ */
+static void PlanSleep(refresh_task_args_t args, display_scan_state_t state);
+
+/**
+ * @brief Responde al nivel de sobrecarga del barrido y alimenta el watchdog
+ *
+ * @param args Argumentos del objeto
+ * @param level Nivel que informó el monitor
+ */
+static void Supervise(refresh_task_args_t args, scan_monitor_level_t level);
 
 /* === Public variable definitions ============================================================= */
 
 /* === Private variable definitions ============================================================ */
 
 /* === Private function implementation ========================================================= */
+static void UpdatePeriod(refresh_task_args_t args, uint32_t delay) {
+    uint16_t period = DisplayScanPeriod(args->scan);
 
-/* === Public function implementation ========================================================= */
-void RefreshDisplay(void * pointer) {
-    static uint32_t half_second_count = 0;
-    static uint32_t thirty_seconds_count = 0;
-    refresh_task_args_t args = (refresh_task_args_t)pointer;
-    TickType_t last_value = xTaskGetTickCount();
-    TickType_t ticks = pdMS_TO_TICKS(1);
-
-    while (true) {
-        if (xEventGroupWaitBits(args->clock_events, TICKS_EVENTS_8, pdTRUE, pdFALSE, 0)) {
-            xEventGroupClearBits(args->clock_events, TICKS_EVENTS_8);
-            thirty_seconds_count = 0;
-        }
-        if (xSemaphoreTake(args->display_mutex, portMAX_DELAY)) {
-            DisplayRefresh(args->board->display);
-            xSemaphoreGive(args->display_mutex);
-        }
-        ClockNewTick(args->clock);
-        half_second_count++;
-        thirty_seconds_count++;
+    if (period != args->period) {
+        args->period = period;
+        ActiveTimerStart(args->scan_timer, delay, period);
+        ScanMonitorRestart(args->monitor);
+    }
+}
 
-        if (half_second_count >= 500) {
-            half_second_count = 0;
-            xEventGroupSetBits(args->clock_events, TICKS_EVENTS_6);
-        }
-        if (thirty_seconds_count >= INACTIVITY_COUNT) {
-            thirty_seconds_count = 0;
-            xEventGroupSetBits(args->clock_events, TICKS_EVENTS_7);
+static void PlanSleep(refresh_task_args_t args, display_scan_state_t state) {
+    uint32_t deadlines[POWER_DEADLINES] = {
+        [POWER_DEADLINE_ALARM] = POWER_NO_DEADLINE,
+        [POWER_DEADLINE_BLINK] = POWER_NO_DEADLINE,
+        [POWER_DEADLINE_INACTIVITY] = DisplayScanMsToNextState(args->scan),
+        [POWER_DEADLINE_ROLLOVER] = POWER_NO_DEADLINE,
+    };
+    uint16_t sweeps = DisplaySweepsToChange(args->board->display);
+    uint32_t delay;
+
+    if (state != DISPLAY_SCAN_BLANK && sweeps != DISPLAY_NO_CHANGE) {
+        deadlines[POWER_DEADLINE_BLINK] = DisplayScanSweepsToMs(args->scan, sweeps) - args->pending_ms;
+    }
+
+    delay = PowerPlanSleep(deadlines);
+    // Con un período que no coincide con el del planificador la próxima actividad vuelve a refrescar enseguida
+    args->period = 0;
+    ScanMonitorRestart(args->monitor);
+    if (delay == POWER_NO_DEADLINE) {
+        ActiveTimerStop(args->scan_timer);
+    } else {
+        ActiveTimerStart(args->scan_timer, delay, 0);
+    }
+}
+
+static void Supervise(refresh_task_args_t args, scan_monitor_level_t level) {
+    if (level != args->level) {
+        TRACE_RECORD(TRACE_SCAN_LEVEL, 0, level);
+        if (level == SCAN_MONITOR_DEGRADE) {
+            // El brillo más bajo es el que pide la frecuencia sin parpadeo más lenta
+            DisplayScanSetBrightness(args->scan, 0);
+        } else if (args->level == SCAN_MONITOR_DEGRADE && level != SCAN_MONITOR_RESET) {
+            DisplayScanSetBrightness(args->scan, DISPLAY_SCAN_BRIGHTNESS);
         }
-        xTaskDelayUntil(&last_value, ticks);
+        args->level = level;
+    }
+#if SCAN_WATCHDOG
+    // Con el reinicio pedido se deja de alimentar y el watchdog vence solo
+    if (level != SCAN_MONITOR_RESET) {
+        BoardWatchdogFeed();
+    }
+#endif
+}
+
+/* === Public function implementation ========================================================= */
+void RefreshHandler(const input_event_t * event, void * context) {
+    refresh_task_args_t args = (refresh_task_args_t)context;
+    TickType_t now = xTaskGetTickCount();
+    uint32_t elapsed;
+    uint32_t sweeps;
+    display_scan_state_t state;
+
+    if (event->kind == INPUT_ACTIVITY) {
+        ActiveTimerStart(args->inactivity, INACTIVITY_TIMEOUT_MS, 0);
+        DisplayScanActivity(args->scan);
+        // Si la pantalla estaba en reposo o apagada se refresca enseguida con el período nuevo
+        UpdatePeriod(args, 0);
+        return;
+    }
+    if (event->kind == INPUT_CLOCK_CHANGED && args->period != 0) {
+        // Refrescando periódicamente la hora nueva se ve en el próximo barrido
+        return;
+    }
+    if (event->kind != INPUT_SCAN && event->kind != INPUT_CLOCK_CHANGED) {
+        return;
+    }
+
+    if (event->kind == INPUT_SCAN && args->period != 0 && args->monitor) {
+        Supervise(args, ScanMonitorScan(args->monitor, now * portTICK_PERIOD_MS, event->timestamp, args->period));
+    }
+    elapsed = now - args->last_tick;
+    args->last_tick = now;
+    if (ClockIsAlarmActive(args->clock)) {
+        DisplayScanActivity(args->scan);
+    }
+    state = DisplayScanElapsed(args->scan, elapsed);
+
+    if (state == DISPLAY_SCAN_BLANK) {
+        DisplayTurnOff(args->board->display);
+    } else if (FRAME_DRIVEN) {
+        args->pending_ms += elapsed;
+        sweeps = args->pending_ms / DisplayScanSweepsToMs(args->scan, 1);
+        args->pending_ms -= DisplayScanSweepsToMs(args->scan, sweeps);
+        DisplayAdvance(args->board->display, (uint16_t)sweeps);
+    } else {
+        PROFILE_BEGIN(PROFILE_DISPLAY_REFRESH);
+        DisplaySetSweepStep(args->board->display, DisplayScanSweepStep(args->scan));
+        DisplayRefresh(args->board->display);
+        PROFILE_END(PROFILE_DISPLAY_REFRESH);
+    }
+    if (FRAME_DRIVEN || (LOW_POWER_MODE && state == DISPLAY_SCAN_BLANK)) {
+        PlanSleep(args, state);
+    } else {
+        UpdatePeriod(args, DisplayScanPeriod(args->scan));
     }
 }
 
@@ -0,0 +1,177 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, María Ayelén Vega Caro <ayelenvegacaro@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file  encoder.c
+ ** @brief Decodificación en cuadratura de un encoder rotativo desde la interrupción de sus pines
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+#include "encoder.h"
+#include <stddef.h>
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+#define ENCODER_STATE_MASK (ENCODER_CHANNEL_A | ENCODER_CHANNEL_B)
+#define ENCODER_INVALID    2 ///< Valor de la tabla cuando cambiaron los dos canales
+
+/* === Private data type declarations ============================================================================== */
+//! Estructura que define al encoder
+struct encoder_s {
+    encoder_config_t config;
+    encoder_notify_t notify;
+    void * context;
+    uint8_t state;          //!< Último estado leído de los pines
+    int8_t position;        //!< Transiciones acumuladas del paso en curso
+    int8_t direction;       //!< Sentido del último paso completo
+    uint32_t last_step;     //!< Momento del último paso completo
+    volatile uint32_t up;   //!< Pasos escalados en sentido horario, lo escribe solamente la interrupción
+    volatile uint32_t down; //!< Pasos escalados en sentido antihorario, lo escribe solamente la interrupción
+    uint32_t up_taken;      //!< Valor de up en la última lectura de la tarea
+    uint32_t down_taken;    //!< Valor de down en la última lectura de la tarea
+    volatile uint16_t errors;
+};
+
+_Static_assert(sizeof(struct encoder_s) <= ENCODER_RAM, "ENCODER_RAM no alcanza para el encoder");
+
+/* === Private function declarations =============================================================================== */
+/**
+ * @brief Calcula cuántos valores avanza un paso según el tiempo desde el paso anterior
+ *
+ * @param self Referencia al encoder
+ * @param direction Sentido del paso
+ * @param timestamp Momento del paso
+ */
+static uint8_t EncoderScale(encoder_t self, int8_t direction, uint32_t timestamp);
+
+/* === Private variable definitions ================================================================================ */
+/**
+ * @brief Movimiento de cada transición, con el estado anterior en los bits 3 y 2 y el nuevo en los bits 1 y 0
+ *
+ * En sentido horario el canal A adelanta al B y los estados siguen la secuencia 00, 10, 11, 01.
+ */
+static const int8_t TRANSITIONS[16] = {
+    0, -1, 1, ENCODER_INVALID, 1, 0, ENCODER_INVALID, -1, -1, ENCODER_INVALID, 0, 1, ENCODER_INVALID, 1, -1, 0,
+};
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+static uint8_t EncoderScale(encoder_t self, int8_t direction, uint32_t timestamp) {
+    uint32_t elapsed = timestamp - self->last_step;
+
+    // Al cambiar de sentido se vuelve a empezar despacio, así es fácil corregir el último valor
+    if (direction != self->direction) {
+        return 1;
+    }
+    if (elapsed < self->config->fast_ms) {
+        return self->config->fast_scale;
+    }
+    if (elapsed < self->config->medium_ms) {
+        return self->config->medium_scale;
+    }
+    return 1;
+}
+
+/* === Public function implementation ============================================================================== */
+encoder_t EncoderCreate(uint8_t state) {
+    static struct encoder_s self[1];
+
+    memset(self, 0, sizeof(struct encoder_s));
+    self->state = state & ENCODER_STATE_MASK;
+    return self;
+}
+
+int EncoderStart(encoder_t self, encoder_config_t config, encoder_notify_t notify, void * context) {
+    if (!self || !config || config->medium_scale == 0 || config->fast_scale == 0) {
+        return -1;
+    }
+    if (config->transitions != 1 && config->transitions != 2 && config->transitions != 4) {
+        return -1;
+    }
+    self->context = context;
+    self->notify = notify;
+    self->config = config;
+    return 0;
+}
+
+void EncoderEdgeFromIsr(encoder_t self, uint8_t state, uint32_t timestamp) {
+    int8_t movement;
+    int8_t direction;
+    uint8_t scale;
+
+    if (!self) {
+        return;
+    }
+    state &= ENCODER_STATE_MASK;
+    movement = TRANSITIONS[(self->state << 2) | state];
+    self->state = state;
+    if (movement == ENCODER_INVALID) {
+        // No se sabe hacia dónde se movió, así que se descarta el paso en curso en lugar de adivinar
+        self->errors++;
+        self->position = 0;
+        return;
+    }
+    if (!self->config || movement == 0) {
+        return;
+    }
+
+    self->position += movement;
+    if (self->position >= self->config->transitions) {
+        direction = 1;
+    } else if (self->position <= -self->config->transitions) {
+        direction = -1;
+    } else {
+        return;
+    }
+    self->position = 0;
+    scale = EncoderScale(self, direction, timestamp);
+    if (direction > 0) {
+        self->up += scale;
+    } else {
+        self->down += scale;
+    }
+    self->direction = direction;
+    self->last_step = timestamp;
+    if (self->notify != NULL) {
+        self->notify(self->context);
+    }
+}
+
+int32_t EncoderTake(encoder_t self) {
+    uint32_t up;
+    uint32_t down;
+
+    if (!self) {
+        return 0;
+    }
+    // Cada contador lo escribe un solo lado, así que alcanza con leerlo una vez para tener un valor consistente
+    up = self->up;
+    down = self->down;
+    up -= self->up_taken;
+    down -= self->down_taken;
+    self->up_taken += up;
+    self->down_taken += down;
+    return (int32_t)(up - down);
+}
+
+uint16_t EncoderErrors(encoder_t self) {
+    return self ? self->errors : 0;
+}
+
+/* === End of documentation ======================================================================================== */
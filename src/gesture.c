@@ -0,0 +1,271 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, María Ayelén Vega Caro <ayelenvegacaro@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file  gesture.c
+ ** @brief Reconocedor de gestos de las teclas
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+#include "gesture.h"
+#include <stddef.h>
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+/* === Private data type declarations ============================================================================== */
+//! Estados de una tecla
+typedef enum {
+    GESTURE_IDLE,        ///< Suelta
+    GESTURE_PENDING,     ///< Presionada sin decidir todavía el gesto
+    GESTURE_HELD,        ///< Presionada después de informar la pulsación, esperando repeticiones
+    GESTURE_WAIT_DOUBLE, ///< Soltada después de una pulsación, esperando la segunda
+    GESTURE_DONE,        ///< Presionada con el gesto ya informado, hasta que se suelte
+} gesture_state_t;
+
+//! Estado de una tecla
+struct gesture_key_s {
+    gesture_state_t state;
+    uint32_t pressed_at;  //!< Momento de la pulsación
+    uint32_t released_at; //!< Momento de la liberación, para la doble pulsación
+    uint32_t repeat_at;   //!< Momento de la próxima repetición
+    uint16_t period;      //!< Período de repetición actual
+    uint16_t count;       //!< Repeticiones informadas
+};
+
+//! Estructura que define al reconocedor
+struct gesture_s {
+    gesture_config_t config;
+    uint8_t keys;
+    struct gesture_key_s state[GESTURE_MAX_KEYS];
+};
+
+_Static_assert(sizeof(struct gesture_s) <= GESTURE_RAM, "GESTURE_RAM no alcanza para el reconocedor");
+
+/* === Private function declarations =============================================================================== */
+/**
+ * @brief Calcula cuánto falta para un momento, o 0 si ya pasó
+ *
+ * @param now Tiempo actual
+ * @param deadline Momento buscado
+ */
+static uint32_t GestureRemaining(uint32_t now, uint32_t deadline);
+
+/**
+ * @brief Indica si una tecla tiene un gesto en la máscara
+ *
+ * @param mask Máscara de la configuración
+ * @param key Número de tecla
+ */
+static bool GestureHas(uint32_t mask, uint8_t key);
+
+/**
+ * @brief Informa un gesto
+ *
+ * @param key Tecla del gesto
+ * @param kind Gesto
+ * @param other Segunda tecla del acorde
+ * @param count Número de repetición
+ * @param timestamp Momento del gesto
+ * @param handler Función que recibe el gesto
+ * @param context Argumento de la función
+ */
+static void GestureEmit(uint8_t key, gesture_kind_t kind, uint8_t other, uint16_t count, uint32_t timestamp,
+                        gesture_handler_t handler, void * context);
+
+/**
+ * @brief Informa la pulsación corta y empieza a esperar las repeticiones
+ *
+ * @param self Referencia al reconocedor
+ * @param key Número de tecla
+ * @param handler Función que recibe el gesto
+ * @param context Argumento de la función
+ */
+static void GesturePress(gesture_t self, uint8_t key, gesture_handler_t handler, void * context);
+
+/* === Private variable definitions ================================================================================ */
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+static uint32_t GestureRemaining(uint32_t now, uint32_t deadline) {
+    int32_t remaining = (int32_t)(deadline - now);
+    return remaining > 0 ? (uint32_t)remaining : 0;
+}
+
+static bool GestureHas(uint32_t mask, uint8_t key) {
+    return (mask & (1UL << key)) != 0;
+}
+
+static void GestureEmit(uint8_t key, gesture_kind_t kind, uint8_t other, uint16_t count, uint32_t timestamp,
+                        gesture_handler_t handler, void * context) {
+    struct gesture_event_s event = {
+        .kind = kind,
+        .key = key,
+        .other = other,
+        .count = count,
+        .timestamp = timestamp,
+    };
+
+    if (handler != NULL) {
+        handler(&event, context);
+    }
+}
+
+static void GesturePress(gesture_t self, uint8_t key, gesture_handler_t handler, void * context) {
+    struct gesture_key_s * state = &self->state[key];
+
+    GestureEmit(key, GESTURE_PRESS, key, 0, state->pressed_at, handler, context);
+    if (GestureHas(self->config->repeat_keys, key)) {
+        state->state = GESTURE_HELD;
+        state->repeat_at = state->pressed_at + self->config->repeat_delay_ms;
+        state->period = self->config->repeat_start_ms;
+        state->count = 0;
+    } else {
+        state->state = GESTURE_DONE;
+    }
+}
+
+/* === Public function implementation ============================================================================== */
+gesture_t GestureCreate(gesture_config_t config, uint8_t keys) {
+    static struct gesture_s self[1];
+
+    if (!config || keys == 0 || keys > GESTURE_MAX_KEYS || (config->repeat_keys && config->repeat_min_ms == 0)) {
+        return NULL;
+    }
+    memset(self, 0, sizeof(struct gesture_s));
+    self->config = config;
+    self->keys = keys;
+    return self;
+}
+
+void GestureKey(gesture_t self, uint8_t key, bool pressed, uint32_t timestamp, gesture_handler_t handler,
+                void * context) {
+    gesture_config_t config;
+    struct gesture_key_s * state;
+
+    if (!self || key >= self->keys) {
+        return;
+    }
+    config = self->config;
+    state = &self->state[key];
+
+    if (!pressed) {
+        if (state->state == GESTURE_PENDING && GestureHas(config->double_keys, key)) {
+            state->state = GESTURE_WAIT_DOUBLE;
+            state->released_at = timestamp;
+        } else if (state->state == GESTURE_PENDING) {
+            GestureEmit(key, GESTURE_PRESS, key, 0, state->pressed_at, handler, context);
+            state->state = GESTURE_IDLE;
+        } else if (state->state != GESTURE_WAIT_DOUBLE) {
+            state->state = GESTURE_IDLE;
+        }
+        return;
+    }
+
+    if (GestureHas(config->chord_keys, key)) {
+        for (uint8_t first = 0; first < self->keys; first++) {
+            struct gesture_key_s * other = &self->state[first];
+            if (first != key && other->state == GESTURE_PENDING && GestureHas(config->chord_keys, first) &&
+                timestamp - other->pressed_at <= config->chord_ms) {
+                GestureEmit(first, GESTURE_CHORD, key, 0, timestamp, handler, context);
+                other->state = GESTURE_DONE;
+                state->state = GESTURE_DONE;
+                return;
+            }
+        }
+    }
+
+    if (state->state == GESTURE_WAIT_DOUBLE) {
+        if (timestamp - state->released_at <= config->double_ms) {
+            GestureEmit(key, GESTURE_DOUBLE, key, 0, timestamp, handler, context);
+            state->state = GESTURE_DONE;
+            return;
+        }
+        // La espera venció sin que se procesara, así que la primera pulsación se informa antes que esta
+        GestureEmit(key, GESTURE_PRESS, key, 0, state->pressed_at, handler, context);
+    }
+
+    state->pressed_at = timestamp;
+    state->state = GESTURE_PENDING;
+    if (!GestureHas(config->chord_keys | config->double_keys, key) && config->long_ms[key] == 0) {
+        GesturePress(self, key, handler, context);
+    }
+}
+
+uint32_t GestureProcess(gesture_t self, uint32_t now, gesture_handler_t handler, void * context) {
+    uint32_t next = GESTURE_NO_DEADLINE;
+    uint32_t remaining;
+    gesture_config_t config;
+
+    if (!self) {
+        return next;
+    }
+    config = self->config;
+
+    for (uint8_t key = 0; key < self->keys; key++) {
+        struct gesture_key_s * state = &self->state[key];
+
+        if (state->state == GESTURE_PENDING && config->long_ms[key] != 0) {
+            remaining = GestureRemaining(now, state->pressed_at + config->long_ms[key]);
+            if (remaining == 0) {
+                GestureEmit(key, GESTURE_LONG, key, 0, state->pressed_at + config->long_ms[key], handler, context);
+                state->state = GESTURE_DONE;
+            } else if (remaining < next) {
+                next = remaining;
+            }
+        } else if (state->state == GESTURE_PENDING && !GestureHas(config->double_keys, key)) {
+            // Solamente espera un acorde, que ya no puede llegar cuando vence su tiempo
+            remaining = GestureRemaining(now, state->pressed_at + config->chord_ms);
+            if (remaining == 0) {
+                GesturePress(self, key, handler, context);
+            } else if (remaining < next) {
+                next = remaining;
+            }
+        } else if (state->state == GESTURE_WAIT_DOUBLE) {
+            remaining = GestureRemaining(now, state->released_at + config->double_ms);
+            if (remaining == 0) {
+                GestureEmit(key, GESTURE_PRESS, key, 0, state->pressed_at, handler, context);
+                state->state = GESTURE_IDLE;
+            } else if (remaining < next) {
+                next = remaining;
+            }
+        }
+
+        if (state->state == GESTURE_HELD) {
+            // Se informan todas las repeticiones vencidas, así el valor avanza lo mismo aunque la tarea se demore
+            while (GestureRemaining(now, state->repeat_at) == 0) {
+                uint16_t shorter = (uint16_t)((uint32_t)state->period * config->repeat_accel / 100);
+                state->count++;
+                GestureEmit(key, GESTURE_REPEAT, key, state->count, state->repeat_at, handler, context);
+                state->repeat_at += state->period;
+                state->period -= shorter;
+                if (state->period < config->repeat_min_ms) {
+                    state->period = config->repeat_min_ms;
+                }
+            }
+            remaining = GestureRemaining(now, state->repeat_at);
+            if (remaining < next) {
+                next = remaining;
+            }
+        }
+    }
+    return next;
+}
+
+/* === End of documentation ======================================================================================== */
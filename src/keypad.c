@@ -0,0 +1,257 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, María Ayelén Vega Caro <ayelenvegacaro@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file  keypad.c
+ ** @brief Procesamiento de las teclas despertado por las interrupciones de sus pines
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+#include "keypad.h"
+#include <stddef.h>
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+#define KEYPAD_QUEUE_MASK (KEYPAD_QUEUE_SIZE - 1)
+
+/* === Private data type declarations ============================================================================== */
+//! Flanco guardado por la interrupción
+struct keypad_edge_s {
+    uint32_t timestamp;
+    uint8_t key;
+};
+
+//! Estructura que define al teclado
+struct keypad_s {
+    uint8_t keys;
+    keypad_read_t read;
+    keypad_config_t config;
+    keypad_notify_t notify;
+    void * context;
+    uint32_t mask;                          //!< Bits de la palabra leída que son teclas
+    uint32_t long_mask;                     //!< Bits de las teclas con pulsación larga
+    uint8_t bit_of_key[KEYPAD_MAX_KEYS];
+    uint8_t key_of_bit[KEYPAD_MAX_KEYS];
+    keypad_debounce_t debounce;
+    bool scanning;                          //!< Indica si hay teclas cambiando y se debe seguir muestreando
+    uint32_t last_scan;                     //!< Momento de la última muestra
+    uint32_t edge_pending;                  //!< Bits con un flanco desde el último cambio de estado
+    uint32_t edge_at[KEYPAD_MAX_KEYS];      //!< Momento del primer flanco desde el último cambio de estado
+    uint32_t long_sent;                     //!< Bits cuya pulsación larga ya se informó
+    uint32_t pressed_at[KEYPAD_MAX_KEYS];   //!< Momento en que comenzó la pulsación de cada tecla
+    struct keypad_edge_s queue[KEYPAD_QUEUE_SIZE];
+    volatile uint8_t head; //!< Lo escribe solamente la interrupción
+    volatile uint8_t tail; //!< Lo escribe solamente la tarea
+    volatile uint16_t overruns;
+};
+
+_Static_assert(sizeof(struct keypad_s) <= KEYPAD_RAM, "KEYPAD_RAM no alcanza para el teclado");
+
+/* === Private function declarations =============================================================================== */
+/**
+ * @brief Calcula cuánto falta para un momento, o 0 si ya pasó
+ *
+ * @param now Tiempo actual
+ * @param deadline Momento buscado
+ */
+static uint32_t KeypadRemaining(uint32_t now, uint32_t deadline);
+
+/**
+ * @brief Toma una muestra de todas las teclas e informa las que cambiaron de estado
+ *
+ * @param self Referencia al teclado
+ * @param now Tiempo actual
+ * @param handler Función que recibe las acciones
+ * @param context Argumento de la función
+ */
+static void KeypadSample(keypad_t self, uint32_t now, keypad_handler_t handler, void * context);
+
+/* === Private variable definitions ================================================================================ */
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+static uint32_t KeypadRemaining(uint32_t now, uint32_t deadline) {
+    int32_t remaining = (int32_t)(deadline - now);
+    return remaining > 0 ? (uint32_t)remaining : 0;
+}
+
+static void KeypadSample(keypad_t self, uint32_t now, keypad_handler_t handler, void * context) {
+    uint32_t sample = self->read() & self->mask;
+    uint32_t changed = KeypadDebounce(&self->debounce, sample);
+
+    self->last_scan = now;
+    // Solamente se recorren las teclas que cambiaron, que casi nunca son más de una
+    while (changed != 0) {
+        uint8_t bit = (uint8_t)__builtin_ctz(changed);
+        uint32_t bit_mask = 1UL << bit;
+        uint8_t key = self->key_of_bit[bit];
+        uint32_t timestamp = (self->edge_pending & bit_mask) ? self->edge_at[key] : now;
+
+        changed &= ~bit_mask;
+        self->edge_pending &= ~bit_mask;
+        if (self->debounce.state & bit_mask) {
+            self->pressed_at[key] = timestamp;
+            self->long_sent &= ~bit_mask;
+        }
+        if (handler != NULL) {
+            handler(key, (self->debounce.state & bit_mask) ? KEYPAD_PRESSED : KEYPAD_RELEASED, timestamp, context);
+        }
+    }
+
+    if ((sample ^ self->debounce.state) == 0) {
+        // Los rebotes que volvieron al estado estable no cuentan como flanco de la próxima pulsación
+        self->scanning = false;
+        self->edge_pending = 0;
+    }
+}
+
+/* === Public function implementation ============================================================================== */
+uint32_t KeypadDebounce(keypad_debounce_t * self, uint32_t sample) {
+    uint32_t delta = sample ^ self->state;
+    uint32_t changed;
+
+    self->count1 = (self->count1 ^ self->count0) & delta;
+    self->count0 = ~self->count0 & delta;
+    changed = delta & ~(self->count0 | self->count1);
+    self->state ^= changed;
+    return changed;
+}
+
+keypad_t KeypadCreate(const uint8_t * bits, uint8_t keys, keypad_read_t read) {
+    static struct keypad_s self[1];
+
+    if (!bits || !read || keys == 0 || keys > KEYPAD_MAX_KEYS) {
+        return NULL;
+    }
+    memset(self, 0, sizeof(struct keypad_s));
+    for (uint8_t key = 0; key < keys; key++) {
+        if (bits[key] >= KEYPAD_MAX_KEYS || (self->mask & (1UL << bits[key]))) {
+            return NULL;
+        }
+        self->bit_of_key[key] = bits[key];
+        self->key_of_bit[bits[key]] = key;
+        self->mask |= 1UL << bits[key];
+    }
+    self->keys = keys;
+    self->read = read;
+    return self;
+}
+
+int KeypadStart(keypad_t self, keypad_config_t config, keypad_notify_t notify, void * context) {
+    if (!self || !config || config->scan_ms == 0) {
+        return -1;
+    }
+    self->config = config;
+    self->long_mask = 0;
+    for (uint8_t key = 0; key < self->keys; key++) {
+        if (config->long_press_ms[key] != 0) {
+            self->long_mask |= 1UL << self->bit_of_key[key];
+        }
+    }
+    self->context = context;
+    self->notify = notify;
+    if (notify != NULL && self->head != self->tail) {
+        notify(context);
+    }
+    return 0;
+}
+
+void KeypadEdgeFromIsr(keypad_t self, uint8_t key, uint32_t timestamp) {
+    uint8_t head;
+
+    if (!self || key >= self->keys) {
+        return;
+    }
+    head = self->head;
+    if (((head + 1) & KEYPAD_QUEUE_MASK) == self->tail) {
+        self->overruns++;
+    } else {
+        self->queue[head].timestamp = timestamp;
+        self->queue[head].key = key;
+        self->head = (head + 1) & KEYPAD_QUEUE_MASK;
+    }
+    if (self->notify != NULL) {
+        self->notify(self->context);
+    }
+}
+
+uint32_t KeypadProcess(keypad_t self, uint32_t now, keypad_handler_t handler, void * context) {
+    uint32_t next = KEYPAD_NO_DEADLINE;
+    uint32_t remaining;
+    uint32_t waiting;
+
+    if (!self || !self->config) {
+        return next;
+    }
+
+    while (self->tail != self->head) {
+        struct keypad_edge_s * edge = &self->queue[self->tail];
+        uint32_t bit_mask = 1UL << self->bit_of_key[edge->key];
+        if (!(self->edge_pending & bit_mask)) {
+            self->edge_pending |= bit_mask;
+            self->edge_at[edge->key] = edge->timestamp;
+        }
+        if (!self->scanning) {
+            // El primer flanco después de estar quieto se muestrea enseguida
+            self->scanning = true;
+            self->last_scan = now - self->config->scan_ms;
+        }
+        self->tail = (self->tail + 1) & KEYPAD_QUEUE_MASK;
+    }
+
+    if (self->scanning) {
+        remaining = KeypadRemaining(now, self->last_scan + self->config->scan_ms);
+        if (remaining == 0) {
+            KeypadSample(self, now, handler, context);
+            remaining = self->config->scan_ms;
+        }
+        if (self->scanning) {
+            next = remaining;
+        }
+    }
+
+    waiting = self->debounce.state & self->long_mask & ~self->long_sent;
+    while (waiting != 0) {
+        uint8_t bit = (uint8_t)__builtin_ctz(waiting);
+        uint8_t key = self->key_of_bit[bit];
+        uint32_t deadline = self->pressed_at[key] + self->config->long_press_ms[key];
+
+        waiting &= ~(1UL << bit);
+        remaining = KeypadRemaining(now, deadline);
+        if (remaining == 0) {
+            self->long_sent |= 1UL << bit;
+            if (handler != NULL) {
+                handler(key, KEYPAD_LONG_PRESSED, deadline, context);
+            }
+        } else if (remaining < next) {
+            next = remaining;
+        }
+    }
+    return next;
+}
+
+bool KeypadIsPressed(keypad_t self, uint8_t key) {
+    return self && key < self->keys && (self->debounce.state & (1UL << self->bit_of_key[key]));
+}
+
+uint16_t KeypadOverruns(keypad_t self) {
+    return self ? self->overruns : 0;
+}
+
+/* === End of documentation ======================================================================================== */
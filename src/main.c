@@ -24,6 +24,7 @@ SPDX-License-Identifier: MIT
 /* === Headers files inclusions =============================================================== */
 #include "tasks_init.h"
 #include "alarm_driver.h"
+#include "FreeRTOS.h"
 
 /* === Macros definitions ====================================================================== */
 #define ALARM_POSTPONE_MINUTES 5    ///< Cantidad de minutos que se pospone la alarma
@@ -31,6 +32,13 @@ SPDX-License-Identifier: MIT
 
 /* === Private data type declarations ========================================================== */
 
+//! Memoria libre del heap de FreeRTOS en cada etapa del arranque, para consultarla con el depurador
+struct boot_heap_s {
+    size_t at_start;    //!< Bytes libres antes de crear la placa
+    size_t after_board; //!< Bytes libres con la placa, el reloj y la alarma ya creados
+    size_t after_tasks; //!< Bytes libres con las tareas y la cola de eventos ya creadas
+};
+
 /* === Private variable declarations =========================================================== */
 
 /* === Private function declarations =========================================================== */
@@ -38,6 +46,7 @@ SPDX-License-Identifier: MIT
 /* === Public variable definitions ============================================================= */
 
 /* === Private variable definitions ============================================================ */
+static volatile struct boot_heap_s boot_heap;
 
 /* === Private function implementation ========================================================= */
 
@@ -47,10 +56,17 @@ int main(void) {
     static clock_t clock;
     static clock_alarm_driver_t driver_alarm;
 
+    boot_heap.at_start = xPortGetFreeHeapSize();
     board = BoardCreate();
-    driver_alarm = AlarmDriverCreate(board);
+    driver_alarm = board ? AlarmDriverCreate(board) : NULL;
+    if (driver_alarm == NULL) {
+        // Sin teclado, pantalla o salidas de la alarma no hay reloj que arrancar
+        return -1;
+    }
     clock = ClockCreate(TICKS_PER_SECOND, ALARM_POSTPONE_MINUTES, driver_alarm);
+    boot_heap.after_board = xPortGetFreeHeapSize();
     TasksInit(clock, board);
+    boot_heap.after_tasks = xPortGetFreeHeapSize();
     vTaskStartScheduler();
 }
 
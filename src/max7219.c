@@ -0,0 +1,107 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, María Ayelén Vega Caro <ayelenvegacaro@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file  max7219.c
+ ** @brief Driver de display para controladores MAX7219 conectados por SPI
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+#include "max7219.h"
+#include <stddef.h>
+
+/* === Macros definitions ========================================================================================== */
+//! Arma una palabra de escritura de registro del MAX7219
+#define MAX7219_WORD(reg, data) ((uint16_t)(((reg) << 8) | (data)))
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+/**
+ * @brief Envía un cuadro completo al MAX7219 en una sola transferencia
+ *
+ * @param frame Segmentos de cada dígito, con el formato de display.h
+ * @param digits Cantidad de dígitos del cuadro
+ */
+static void Max7219FrameFlush(const uint8_t * frame, uint8_t digits);
+
+/**
+ * @brief Convierte los segmentos del formato de display.h al orden de bits del MAX7219 (DP A B C D E F G)
+ *
+ * @param segments Segmentos en el formato de display.h
+ * @return uint8_t Segmentos en el formato del MAX7219
+ */
+static uint8_t Max7219Segments(uint8_t segments);
+
+/* === Private variable definitions ================================================================================ */
+static max7219_spi_t spi_local;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+static uint8_t Max7219Segments(uint8_t segments) {
+    uint8_t result = segments & SEGMENT_P;
+    for (uint8_t bit = 0; bit < 7; bit++) {
+        if (segments & (1 << bit)) {
+            result |= (1 << (6 - bit));
+        }
+    }
+    return result;
+}
+
+static void Max7219FrameFlush(const uint8_t * frame, uint8_t digits) {
+    uint16_t words[DISPLAY_MAX_DIGITS];
+
+    if (digits > DISPLAY_MAX_DIGITS) {
+        digits = DISPLAY_MAX_DIGITS;
+    }
+    for (uint8_t digit = 0; digit < digits; digit++) {
+        words[digit] = MAX7219_WORD(MAX7219_REG_DIGIT_0 + digit, Max7219Segments(frame[digit]));
+    }
+    spi_local->Transfer(words, digits);
+}
+
+/* === Public function implementation ============================================================================== */
+display_driver_t Max7219DriverCreate(max7219_spi_t spi, uint8_t digits, uint8_t intensity) {
+    static const struct display_driver_s driver = {
+        .FrameFlush = Max7219FrameFlush,
+    };
+    uint16_t setup[5];
+
+    if (spi == NULL || digits == 0) {
+        return NULL;
+    }
+    if (digits > DISPLAY_MAX_DIGITS) {
+        digits = DISPLAY_MAX_DIGITS;
+    }
+    if (intensity > 0x0F) {
+        intensity = 0x0F;
+    }
+
+    spi_local = spi;
+    setup[0] = MAX7219_WORD(MAX7219_REG_DISPLAY_TEST, 0x00);
+    setup[1] = MAX7219_WORD(MAX7219_REG_DECODE_MODE, 0x00);
+    setup[2] = MAX7219_WORD(MAX7219_REG_SCAN_LIMIT, digits - 1);
+    setup[3] = MAX7219_WORD(MAX7219_REG_INTENSITY, intensity);
+    setup[4] = MAX7219_WORD(MAX7219_REG_SHUTDOWN, 0x01);
+    spi_local->Transfer(setup, sizeof(setup) / sizeof(setup[0]));
+
+    return &driver;
+}
+
+/* === End of documentation ======================================================================================== */
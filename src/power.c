@@ -0,0 +1,96 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, María Ayelén Vega Caro <ayelenvegacaro@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file  power.c
+ ** @brief Planificación del bajo consumo
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+#include "power.h"
+#include <stddef.h>
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+/* === Private data type declarations ============================================================================== */
+//! Estado del módulo
+struct power_s {
+    uint32_t expected_ms; //!< Tiempo previsto del sueño en curso
+    power_stats_t stats;
+};
+
+_Static_assert(sizeof(struct power_s) <= POWER_RAM, "POWER_RAM no alcanza para el módulo");
+
+/* === Private function declarations =============================================================================== */
+
+/* === Private variable definitions ================================================================================ */
+static struct power_s power[1];
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+/* === Public function implementation ============================================================================== */
+uint32_t PowerPlanSleep(const uint32_t deadlines[POWER_DEADLINES]) {
+    uint32_t sleep = POWER_NO_DEADLINE;
+    uint8_t reason = POWER_DEADLINES;
+
+    if (deadlines == NULL) {
+        return POWER_NO_DEADLINE;
+    }
+    for (uint8_t deadline = 0; deadline < POWER_DEADLINES; deadline++) {
+        if (deadlines[deadline] < sleep) {
+            sleep = deadlines[deadline];
+            reason = deadline;
+        }
+    }
+    power->stats.plans++;
+    if (reason < POWER_DEADLINES) {
+        power->stats.reasons[reason]++;
+    }
+    // Un vencimiento que ya pasó se atiende en el próximo milisegundo, así nunca se queda despierto esperando
+    return (sleep == 0) ? 1 : sleep;
+}
+
+void PowerSleepEnter(uint32_t expected_ms) {
+    power->expected_ms = expected_ms;
+}
+
+void PowerSleepExit(uint32_t slept_ms) {
+    power->stats.sleeps++;
+    power->stats.slept_ms += slept_ms;
+    if (slept_ms > power->stats.longest_ms) {
+        power->stats.longest_ms = slept_ms;
+    }
+    if (slept_ms < power->expected_ms) {
+        power->stats.early++;
+    }
+}
+
+void PowerGetStats(power_stats_t * stats) {
+    if (stats) {
+        *stats = power->stats;
+    }
+}
+
+void PowerResetStats(void) {
+    memset(power, 0, sizeof(struct power_s));
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,137 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, María Ayelén Vega Caro <ayelenvegacaro@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file  profile.c
+ ** @brief Perfilador de los caminos críticos
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+#if !defined(__ARM_ARCH)
+#define _POSIX_C_SOURCE 199309L // Para clock_gettime con -std=c99
+#include <time.h>
+#endif
+#include "profile.h"
+#include <stddef.h>
+#include <string.h>
+
+#if PROFILE
+
+/* === Macros definitions ========================================================================================== */
+#define DEMCR         (*(volatile uint32_t *)0xE000EDFC) ///< Registro de control de la depuración
+#define DEMCR_TRCENA  (1UL << 24)                        ///< Habilita el DWT
+#define DWT_CTRL      (*(volatile uint32_t *)0xE0001000) ///< Registro de control del DWT
+#define DWT_CYCCNTENA (1UL << 0)                         ///< Habilita el contador de ciclos
+
+/* === Private data type declarations ============================================================================== */
+//! Mediciones de una sonda
+struct profile_probe_s {
+    uint32_t count;
+    uint32_t min;
+    uint32_t max;
+    uint64_t total; //!< Suma de las duraciones, para el promedio
+    uint32_t buckets[PROFILE_BUCKETS];
+};
+
+_Static_assert(sizeof(struct profile_probe_s[PROFILE_PROBES]) <= PROFILE_RAM, "PROFILE_RAM no alcanza para las sondas");
+
+/* === Private function declarations =============================================================================== */
+/**
+ * @brief Elige la cubeta de una duración
+ *
+ * @param counts Duración en cuentas del contador
+ * @return uint8_t Parte entera del logaritmo en base dos, limitada a la última cubeta
+ */
+static uint8_t Bucket(uint32_t counts);
+
+/* === Private variable definitions ================================================================================ */
+static struct profile_probe_s probes[PROFILE_PROBES];
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+static uint8_t Bucket(uint32_t counts) {
+    uint8_t bucket;
+
+    if (counts == 0) {
+        return 0;
+    }
+    // En el Cortex-M4 __builtin_clz es una sola instrucción CLZ
+    bucket = (uint8_t)(31 - __builtin_clz(counts));
+    return (bucket < PROFILE_BUCKETS) ? bucket : PROFILE_BUCKETS - 1;
+}
+
+/* === Public function implementation ============================================================================== */
+void ProfileInit(void) {
+#if defined(__ARM_ARCH)
+    DEMCR |= DEMCR_TRCENA;
+    PROFILE_NOW() = 0; // Las duraciones son restas, pero así el contador arranca lejos de dar la vuelta
+    DWT_CTRL |= DWT_CYCCNTENA;
+#endif
+    ProfileReset();
+}
+
+void ProfileRecord(profile_probe_t probe, uint32_t counts) {
+    struct profile_probe_s * self;
+
+    if (probe >= PROFILE_PROBES) {
+        return;
+    }
+    self = &probes[probe];
+    if (self->count == 0 || counts < self->min) {
+        self->min = counts;
+    }
+    if (counts > self->max) {
+        self->max = counts;
+    }
+    self->count++;
+    self->total += counts;
+    self->buckets[Bucket(counts)]++;
+}
+
+bool ProfileGetStats(profile_probe_t probe, profile_stats_t * stats) {
+    const struct profile_probe_s * self;
+
+    if (probe >= PROFILE_PROBES || stats == NULL) {
+        return false;
+    }
+    self = &probes[probe];
+    stats->count = self->count;
+    stats->min = self->min;
+    stats->max = self->max;
+    stats->mean = self->count ? (uint32_t)(self->total / self->count) : 0;
+    memcpy(stats->buckets, self->buckets, sizeof(stats->buckets));
+    return true;
+}
+
+void ProfileReset(void) {
+    memset(probes, 0, sizeof(probes));
+}
+
+#if !defined(__ARM_ARCH)
+uint32_t ProfileHostNow(void) {
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint32_t)((uint64_t)now.tv_sec * 1000000000u + (uint64_t)now.tv_nsec);
+}
+#endif
+
+#endif
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,167 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, María Ayelén Vega Caro <ayelenvegacaro@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file  scan_monitor.c
+ ** @brief Monitor de los vencimientos del barrido de la pantalla
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+#include "scan_monitor.h"
+#include <stddef.h>
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+/* === Private data type declarations ============================================================================== */
+//! Estructura que define al monitor
+struct scan_monitor_s {
+    scan_monitor_config_t config;
+    bool started;              //!< Hay un barrido anterior con el que medir el período
+    uint32_t last;             //!< Momento del barrido anterior
+    uint16_t window_scans;     //!< Barridos en la ventana que se está midiendo
+    uint16_t window_misses;    //!< Vencimientos perdidos en la ventana que se está midiendo
+    scan_monitor_stats_t stats;
+};
+
+_Static_assert(sizeof(struct scan_monitor_s) <= SCAN_MONITOR_RAM, "SCAN_MONITOR_RAM no alcanza para el monitor");
+
+/* === Private function declarations =============================================================================== */
+/**
+ * @brief Elige la cubeta del histograma para un atraso
+ *
+ * @param late Atraso en ms
+ * @return uint8_t 0 sin atraso, y si no uno más que la parte entera del logaritmo en base dos, limitada a la última
+ */
+static uint8_t LateBucket(uint32_t late);
+
+/**
+ * @brief Cierra una ventana y ajusta el nivel según cuántas ventanas sobrecargadas van seguidas
+ *
+ * @param self Monitor
+ */
+static void CloseWindow(scan_monitor_t self);
+
+/* === Private variable definitions ================================================================================ */
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+static uint8_t LateBucket(uint32_t late) {
+    uint8_t bucket = 0;
+
+    while (late != 0 && bucket < SCAN_MONITOR_BUCKETS - 1) {
+        late >>= 1;
+        bucket++;
+    }
+    return bucket;
+}
+
+static void CloseWindow(scan_monitor_t self) {
+    scan_monitor_stats_t * stats = &self->stats;
+
+    if (self->window_misses >= self->config->overrun_misses) {
+        stats->overrun_windows++;
+        if (stats->streak < UINT8_MAX) {
+            stats->streak++;
+        }
+    } else {
+        stats->streak = 0;
+    }
+    // El reinicio ya pedido no se retira, el watchdog tiene que llegar a vencer
+    if (stats->level != SCAN_MONITOR_RESET) {
+        if (stats->streak >= self->config->reset_windows) {
+            stats->level = SCAN_MONITOR_RESET;
+        } else if (stats->streak >= self->config->degrade_windows) {
+            stats->level = SCAN_MONITOR_DEGRADE;
+        } else if (stats->streak > 0) {
+            stats->level = SCAN_MONITOR_LOG;
+        } else {
+            stats->level = SCAN_MONITOR_OK;
+        }
+    }
+    if (stats->level > stats->worst) {
+        stats->worst = stats->level;
+    }
+    self->window_scans = 0;
+    self->window_misses = 0;
+}
+
+/* === Public function implementation ============================================================================== */
+scan_monitor_t ScanMonitorCreate(scan_monitor_config_t config) {
+    static struct scan_monitor_s self[1];
+
+    if (config == NULL || config->window == 0 || config->overrun_misses == 0 || config->degrade_windows == 0 ||
+        config->reset_windows < config->degrade_windows) {
+        return NULL;
+    }
+    memset(self, 0, sizeof(struct scan_monitor_s));
+    self->config = config;
+    self->stats.period_min = UINT16_MAX;
+    return self;
+}
+
+scan_monitor_level_t ScanMonitorScan(scan_monitor_t self, uint32_t now, uint32_t deadline, uint16_t period) {
+    // Un vencimiento que todavía no llegó cuenta como atendido a tiempo
+    uint32_t late = ((int32_t)(now - deadline) > 0) ? now - deadline : 0;
+    uint32_t interval;
+    uint32_t missed;
+
+    if (!self || period == 0) {
+        return SCAN_MONITOR_OK;
+    }
+    self->stats.scans++;
+    self->stats.late[LateBucket(late)]++;
+    // El núcleo saltea los vencimientos que ya pasaron, uno por cada período completo de atraso
+    missed = late / period;
+    self->stats.missed += missed;
+    self->window_misses = (uint16_t)((self->window_misses + missed > UINT16_MAX) ? UINT16_MAX
+                                                                                  : self->window_misses + missed);
+    if (self->started) {
+        interval = now - self->last;
+        interval = (interval > UINT16_MAX) ? UINT16_MAX : interval;
+        if (interval < self->stats.period_min) {
+            self->stats.period_min = (uint16_t)interval;
+        }
+        if (interval > self->stats.period_max) {
+            self->stats.period_max = (uint16_t)interval;
+        }
+    }
+    self->started = true;
+    self->last = now;
+    if (++self->window_scans == self->config->window) {
+        CloseWindow(self);
+    }
+    return self->stats.level;
+}
+
+void ScanMonitorRestart(scan_monitor_t self) {
+    if (self) {
+        self->started = false;
+    }
+}
+
+bool ScanMonitorGetStats(scan_monitor_t self, scan_monitor_stats_t * stats) {
+    if (!self || !stats) {
+        return false;
+    }
+    *stats = self->stats;
+    return true;
+}
+
+/* === End of documentation ======================================================================================== */
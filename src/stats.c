@@ -0,0 +1,149 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, María Ayelén Vega Caro <ayelenvegacaro@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file  stats.c
+ ** @brief Estadísticas de ejecución del sistema operativo
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+#include "stats.h"
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+#define STATS_PERMILLE 1000 ///< El uso del procesador se guarda en décimas de por ciento
+
+/* === Private data type declarations ============================================================================== */
+//! Estado del módulo
+struct stats_s {
+    bool started;              //!< Ya se tomó una muestra con la que comparar
+    uint32_t total;            //!< Tiempo total acumulado en la muestra anterior
+    stats_snapshot_t snapshot; //!< Foto de la última muestra
+};
+
+_Static_assert(sizeof(struct stats_s) <= STATS_RAM, "STATS_RAM no alcanza para el módulo");
+
+/* === Private function declarations =============================================================================== */
+/**
+ * @brief Busca una tarea en la foto anterior
+ *
+ * @param previous Foto anterior
+ * @param id Número que identifica a la tarea
+ * @return const stats_task_t* Tarea, o NULL si no estaba
+ */
+static const stats_task_t * FindTask(const stats_snapshot_t * previous, uint32_t id);
+
+/* === Private variable definitions ================================================================================ */
+static struct stats_s stats[1];
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+static const stats_task_t * FindTask(const stats_snapshot_t * previous, uint32_t id) {
+    for (uint8_t index = 0; index < previous->count; index++) {
+        if (previous->tasks[index].id == id) {
+            return &previous->tasks[index];
+        }
+    }
+    return NULL;
+}
+
+/* === Public function implementation ============================================================================== */
+void StatsSample(const stats_sample_t tasks[], uint8_t count, uint32_t total, size_t heap_free, size_t heap_min) {
+    stats_snapshot_t previous = stats->snapshot;
+    stats_snapshot_t * snapshot = &stats->snapshot;
+    const stats_task_t * before;
+    stats_task_t * task;
+
+    if (tasks == NULL) {
+        count = 0;
+    }
+    // Las restas sin signo dan bien aunque el contador haya dado la vuelta entre las dos muestras
+    snapshot->elapsed = stats->started ? total - stats->total : 0;
+    snapshot->samples++;
+    snapshot->count = 0;
+    snapshot->dropped = 0;
+    for (uint8_t index = 0; index < count; index++) {
+        if (snapshot->count == STATS_MAX_TASKS) {
+            snapshot->dropped++;
+            continue;
+        }
+        task = &snapshot->tasks[snapshot->count++];
+        task->id = tasks[index].id;
+        task->name = tasks[index].name;
+        task->runtime = tasks[index].runtime;
+        task->stack_free = tasks[index].stack_free;
+        task->cpu = 0;
+        before = FindTask(&previous, task->id);
+        if (before && snapshot->elapsed > 0) {
+            task->cpu = (uint16_t)((uint64_t)(task->runtime - before->runtime) * STATS_PERMILLE / snapshot->elapsed);
+        }
+    }
+    snapshot->heap_free = heap_free;
+    snapshot->heap_min = heap_min;
+    stats->total = total;
+    stats->started = true;
+}
+
+void StatsSampleCost(uint32_t counts) {
+    stats->snapshot.overhead = counts;
+    if (counts > stats->snapshot.overhead_max) {
+        stats->snapshot.overhead_max = counts;
+    }
+}
+
+void StatsGetSnapshot(stats_snapshot_t * snapshot) {
+    if (snapshot) {
+        *snapshot = stats->snapshot;
+    }
+}
+
+size_t StatsFormat(const stats_snapshot_t * snapshot, char * buffer, size_t size) {
+    size_t length = 0;
+    int written;
+
+    if (snapshot == NULL || buffer == NULL || size == 0) {
+        return 0;
+    }
+    buffer[0] = 0;
+    for (uint8_t index = 0; index <= snapshot->count && length < size; index++) {
+        if (index < snapshot->count) {
+            const stats_task_t * task = &snapshot->tasks[index];
+            written = snprintf(&buffer[length], size - length, "%-16s %3u.%u%% %5u\n", task->name ? task->name : "?",
+                               task->cpu / 10, task->cpu % 10, task->stack_free);
+        } else {
+            written = snprintf(&buffer[length], size - length, "heap %u/%u costo %lu/%lu\n",
+                               (unsigned)snapshot->heap_free, (unsigned)snapshot->heap_min,
+                               (unsigned long)snapshot->overhead, (unsigned long)snapshot->overhead_max);
+        }
+        if (written < 0) {
+            break;
+        }
+        length += (size_t)written;
+    }
+    // Si se cortó, snprintf dejó el texto terminado en el último byte
+    return (length < size) ? length : size - 1;
+}
+
+void StatsReset(void) {
+    memset(stats, 0, sizeof(struct stats_s));
+}
+
+/* === End of documentation ======================================================================================== */
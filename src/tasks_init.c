@@ -23,12 +23,69 @@ SPDX-License-Identifier: MIT
 
 /* === Headers files inclusions =============================================================== */
 #include "tasks_init.h"
-#include <stdlib.h>
+#include "alarm_driver.h"
+#include "config.h"
+#include "max7219.h"
+#include "power.h"
+#include "profile.h"
+#include "stats.h"
+#include "trace.h"
 
 /* === Macros definitions ====================================================================== */
-#define BUTTON_SCAN_DELAY 100
+#define ACTIVE_TASK_STACK_SIZE (3 * configMINIMAL_STACK_SIZE) ///< Pila que comparten todos los objetos activos
+
+#define INPUT_PRIORITY         1 ///< Prioridad del objeto de las teclas dentro del núcleo
+#define CLOCK_PRIORITY         2 ///< Prioridad del objeto del reloj dentro del núcleo
+#define REFRESH_PRIORITY       3 ///< Prioridad del objeto de refresco, para que no parpadee
+#define TIMEKEEPER_PRIORITY    4 ///< Prioridad del objeto que lleva la hora, el más urgente para no atrasarla
 
 /* === Private data type declarations ========================================================== */
+typedef struct error_task_args_s {
+    board_t board;
+} * error_task_args_t;
+
+//! Tareas, pilas, colas y argumentos, todos reservados al compilar para que el arranque no dependa del heap
+struct tasks_memory_s {
+    StaticTask_t active_task; //!< Única tarea de la aplicación, donde corren todos los objetos activos
+    StackType_t active_stack[ACTIVE_TASK_STACK_SIZE];
+    active_slot_t input_queue[INPUT_QUEUE_LENGTH];
+    struct input_task_args_s input_args;
+    active_slot_t refresh_queue[REFRESH_QUEUE_LENGTH];
+    struct refresh_task_args_s refresh_args;
+    active_slot_t clock_queue[CLOCK_QUEUE_LENGTH];
+    struct clock_task_args_s clock_args;
+    active_slot_t timekeeper_queue[TIMEKEEPER_QUEUE_LENGTH];
+    struct timekeeper_args_s timekeeper_args;
+    StaticTask_t error_task;
+    StackType_t error_stack[configMINIMAL_STACK_SIZE];
+    struct error_task_args_s error_args;
+    StaticTask_t idle_task; //!< La tarea ociosa la crea el planificador, que pide la memoria con una función
+    StackType_t idle_stack[configMINIMAL_STACK_SIZE];
+#if RUNTIME_STATS
+    TaskStatus_t stats_status[STATS_MAX_TASKS]; //!< Tareas leídas del sistema operativo en cada muestra
+    stats_sample_t stats_samples[STATS_MAX_TASKS];
+#endif
+};
+
+//! Estadísticas de ejecución, para consultarlas y pedir el volcado con el depurador
+struct stats_view_s {
+    uint32_t last;                      //!< Momento de la última muestra en ms
+    stats_snapshot_t snapshot;          //!< Foto de la última muestra
+    volatile bool dump;                 //!< Se pone en verdadero con el depurador para volcar la próxima muestra
+    char text[RUNTIME_STATS_DUMP_SIZE]; //!< Texto de la última muestra que se pidió volcar
+};
+
+//! RAM de las tareas: la de esta estructura, la de las estadísticas y el heap que queda sin uso
+#define TASKS_RAM (sizeof(struct tasks_memory_s) + RUNTIME_STATS * sizeof(struct stats_view_s) + configTOTAL_HEAP_SIZE)
+
+//! RAM estática de los módulos, cada uno comprueba al compilar que la suya no supera lo que declara
+#define MODULES_RAM                                                                                                    \
+    (ACTIVE_RAM + BOARD_RAM + DIGITAL_RAM + KEYPAD_RAM + GESTURE_RAM + BOARD_ENCODER * ENCODER_RAM + DISPLAY_RAM +     \
+     BOARD_DISPLAY_MAX7219 * MAX7219_RAM + DISPLAY_SCAN_RAM + SCAN_MONITOR_RAM + CLOCK_RAM + ALARM_DRIVER_RAM +        \
+     POWER_RAM + PROFILE * PROFILE_RAM + RUNTIME_STATS * STATS_RAM + TRACE * TRACE_RAM)
+
+_Static_assert(TASKS_RAM + MODULES_RAM <= RAM_BUDGET, "La RAM estática de las tareas y los módulos supera RAM_BUDGET");
+_Static_assert(CLOCK_QUEUE_LENGTH <= UINT8_MAX, "CLOCK_QUEUE_LENGTH no entra en la cola de un objeto activo");
 
 /* === Private variable declarations =========================================================== */
 
@@ -40,12 +97,94 @@ SPDX-License-Identifier: MIT
  */
 void Blinking(void * parameters);
 
+/**
+ * @brief Tiempo actual en ms para el núcleo de objetos activos
+ */
+static uint32_t ActiveClock(void);
+
+#if TRACE
+/**
+ * @brief Marca de tiempo del registro de eventos, en cuentas del temporizador libre
+ */
+static uint32_t TraceClock(void);
+#endif
+
+/**
+ * @brief Tarea del núcleo de objetos activos
+ *
+ * Duerme hasta que una interrupción la notifica o vence el próximo temporizador, y entonces atiende todos los eventos
+ * pendientes. Las interrupciones no encolan, solamente notifican, así las colas de los objetos nunca se comparten con
+ * una interrupción. El tiempo que pasa bloqueada es el que duerme el procesador, y se informa al módulo de bajo
+ * consumo.
+ *
+ * @param parameters Objeto activo de las teclas
+ */
+static void ActiveTask(void * parameters);
+
+#if RUNTIME_STATS
+/**
+ * @brief Toma una muestra de las estadísticas de ejecución si ya pasó el período
+ *
+ * Lee todas las tareas de una vez y mide cuánto tardó con el mismo temporizador, así el costo de las estadísticas
+ * queda en la foto junto con lo que miden.
+ *
+ * @param wait Tiempo hasta el próximo vencimiento del núcleo, o ACTIVE_NO_DEADLINE
+ * @return uint32_t Tiempo a esperar, que no pasa de la próxima muestra
+ */
+static uint32_t SampleStats(uint32_t wait);
+#endif
+
 /* === Public variable definitions ============================================================= */
 
 /* === Private variable definitions ============================================================ */
-typedef struct error_task_args_s {
-    board_t board;
-} * error_task_args_t;
+static struct tasks_memory_s memory;
+
+#if RUNTIME_STATS
+static struct stats_view_s stats_view;
+#endif
+
+static const struct display_scan_config_s scan_config = {
+    .flicker_free_hz = DISPLAY_SCAN_FLICKER_FREE_HZ,
+    .idle_divider = DISPLAY_SCAN_IDLE_DIVIDER,
+    .idle_timeout_ms = DISPLAY_SCAN_IDLE_TIMEOUT,
+    .blank_timeout_ms = DISPLAY_SCAN_BLANK_TIMEOUT,
+    .blank_period_ms = DISPLAY_SCAN_BLANK_PERIOD,
+};
+
+//! Respuesta a la sobrecarga sostenida del barrido de la pantalla
+static const struct scan_monitor_config_s monitor_config = {
+    .window = SCAN_MONITOR_WINDOW,
+    .overrun_misses = SCAN_MONITOR_OVERRUN_MISSES,
+    .degrade_windows = SCAN_MONITOR_DEGRADE_WINDOWS,
+    .reset_windows = SCAN_MONITOR_RESET_WINDOWS,
+};
+
+//! Las pulsaciones largas las reconocen los gestos, así que el teclado solamente filtra los rebotes
+static const struct keypad_config_s keypad_config = {
+    .scan_ms = KEYPAD_SCAN_MS,
+};
+
+//! Gestos de cada tecla y sus tiempos
+static const struct gesture_config_s gesture_config = {
+    .long_ms = {[BOARD_KEY_SET_TIME] = DELAY_SET_TIME, [BOARD_KEY_SET_ALARM] = DELAY_SET_ALARM},
+    .chord_keys = (1 << BOARD_KEY_INCREMENT) | (1 << BOARD_KEY_DECREMENT),
+    .repeat_keys = (1 << BOARD_KEY_INCREMENT) | (1 << BOARD_KEY_DECREMENT),
+    .double_ms = GESTURE_DOUBLE_MS,
+    .chord_ms = GESTURE_CHORD_MS,
+    .repeat_delay_ms = GESTURE_REPEAT_DELAY_MS,
+    .repeat_start_ms = GESTURE_REPEAT_START_MS,
+    .repeat_min_ms = GESTURE_REPEAT_MIN_MS,
+    .repeat_accel = GESTURE_REPEAT_ACCEL,
+};
+
+//! Pasos del encoder, que avanzan más valores cuanto más rápido se gira
+static const struct encoder_config_s encoder_config = {
+    .transitions = ENCODER_TRANSITIONS,
+    .medium_ms = ENCODER_MEDIUM_MS,
+    .fast_ms = ENCODER_FAST_MS,
+    .medium_scale = ENCODER_MEDIUM_SCALE,
+    .fast_scale = ENCODER_FAST_SCALE,
+};
 
 /* === Private function implementation ========================================================= */
 void Blinking(void * parameters) {
@@ -56,92 +195,175 @@ void Blinking(void * parameters) {
     }
 }
 
-/* === Public function implementation ========================================================= */
-void TasksInit(clock_t clock, board_t board) {
-    EventGroupHandle_t clock_events;
-    SemaphoreHandle_t display_mutex;
-    BaseType_t result;
-
-    display_mutex = xSemaphoreCreateMutex();
-    clock_events = xEventGroupCreate();
-
-    static button_state_t button_set_time = {false, false, 0, DELAY_SET_TIME};
-    static button_state_t button_set_alarm = {false, false, 0, DELAY_SET_ALARM};
-
-    if (clock_events && display_mutex) {
-        button_task_args_t button_args = malloc(sizeof(*button_args));
-        button_args->clock_events = clock_events;
-        button_args->event_bit = BUTTON_ACCEPT;
-        button_args->button = board->accept;
-        result =
-            xTaskCreate(ButtonTask, "Button_Accept", BUTTON_TASK_STACK_SIZE, button_args, tskIDLE_PRIORITY + 1, NULL);
-    }
-    if (result == pdPASS) {
-        button_task_args_t button_args = malloc(sizeof(*button_args));
-        button_args->clock_events = clock_events;
-        button_args->event_bit = BUTTON_CANCEL;
-        button_args->button = board->cancel;
-        result =
-            xTaskCreate(ButtonTask, "Button_Cancel", BUTTON_TASK_STACK_SIZE, button_args, tskIDLE_PRIORITY + 1, NULL);
-    }
+static uint32_t ActiveClock(void) {
+    return xTaskGetTickCount() * portTICK_PERIOD_MS;
+}
 
-    if (result == pdPASS) {
-        button_task_args_t button_args = malloc(sizeof(*button_args));
-        button_args->clock_events = clock_events;
-        button_args->event_bit = BUTTON_INCREMENT;
-        button_args->button = board->increment;
-        result = xTaskCreate(ButtonTask, "Button_Increment", BUTTON_TASK_STACK_SIZE, button_args, tskIDLE_PRIORITY + 1,
-                             NULL);
-    }
-    if (result == pdPASS) {
-        button_task_args_t button_args = malloc(sizeof(*button_args));
-        button_args->clock_events = clock_events;
-        button_args->event_bit = BUTTON_DECREMENT;
-        button_args->button = board->decrement;
-        result = xTaskCreate(ButtonTask, "Button_Decrement", BUTTON_TASK_STACK_SIZE, button_args, tskIDLE_PRIORITY + 1,
-                             NULL);
-    }
-    if (result == pdPASS) {
-        button_task_args_t button_args = malloc(sizeof(*button_args));
-        button_args->clock_events = clock_events;
-        button_args->event_bit = BUTTON_SET_TIME;
-        button_args->button = board->set_time;
-        button_args->state = &button_set_time;
-        result = xTaskCreate(ButtonPressedForLongTimeTask, "Button_Set_Time", BUTTON_TASK_STACK_SIZE, button_args,
-                             tskIDLE_PRIORITY + 1, NULL);
+#if RUNTIME_STATS
+static uint32_t SampleStats(uint32_t wait) {
+    uint32_t now = ActiveClock();
+    uint32_t start;
+    uint32_t total;
+    UBaseType_t count;
+
+    if (now - stats_view.last >= RUNTIME_STATS_PERIOD_MS) {
+        stats_view.last = now;
+        start = portGET_RUN_TIME_COUNTER_VALUE();
+        // Si hay más tareas que lugares el sistema operativo no devuelve ninguna, y solamente se toma el heap
+        count = uxTaskGetSystemState(memory.stats_status, STATS_MAX_TASKS, &total);
+        for (UBaseType_t index = 0; index < count; index++) {
+            memory.stats_samples[index].id = memory.stats_status[index].xTaskNumber;
+            memory.stats_samples[index].name = memory.stats_status[index].pcTaskName;
+            memory.stats_samples[index].runtime = memory.stats_status[index].ulRunTimeCounter;
+            memory.stats_samples[index].stack_free = memory.stats_status[index].usStackHighWaterMark;
+        }
+        StatsSample(memory.stats_samples, (uint8_t)count, total, xPortGetFreeHeapSize(),
+                    xPortGetMinimumEverFreeHeapSize());
+        StatsSampleCost(portGET_RUN_TIME_COUNTER_VALUE() - start);
+        StatsGetSnapshot(&stats_view.snapshot);
+        if (stats_view.dump) {
+            StatsFormat(&stats_view.snapshot, stats_view.text, sizeof(stats_view.text));
+            stats_view.dump = false;
+        }
     }
-    if (result == pdPASS) {
-        button_task_args_t button_args = malloc(sizeof(*button_args));
-        button_args->clock_events = clock_events;
-        button_args->event_bit = BUTTON_SET_ALARM;
-        button_args->button = board->set_alarm;
-        button_args->state = &button_set_alarm;
-        result = xTaskCreate(ButtonPressedForLongTimeTask, "Button_Set_Alarm", BUTTON_TASK_STACK_SIZE, button_args,
-                             tskIDLE_PRIORITY + 1, NULL);
+    now = RUNTIME_STATS_PERIOD_MS - (now - stats_view.last);
+    return (wait < now) ? wait : now;
+}
+#endif
+
+#if TRACE
+static uint32_t TraceClock(void) {
+    return RUNTIME_STATS_TIMER->TC;
+}
+#endif
+
+static void ActiveTask(void * parameters) {
+    active_t input = (active_t)parameters;
+    input_event_t poll = {.source = INPUT_SOURCE_KEY, .kind = INPUT_KEY_POLL};
+    uint32_t wait = ACTIVE_NO_DEADLINE;
+    uint32_t signals;
+    uint32_t asleep;
+    BaseType_t notified;
+
+    while (true) {
+        PowerSleepEnter((wait == ACTIVE_NO_DEADLINE) ? POWER_NO_DEADLINE : wait);
+        asleep = ActiveClock();
+        notified = xTaskNotifyWait(0, UINT32_MAX, &signals,
+                                   (wait == ACTIVE_NO_DEADLINE) ? portMAX_DELAY : pdMS_TO_TICKS(wait));
+        // Con el tick suprimido la cuenta se corrige al despertar, así que la diferencia es el tiempo dormido
+        PowerSleepExit(ActiveClock() - asleep);
+        if (notified && (signals & INPUT_NOTIFY_BIT)) {
+            poll.timestamp = ActiveClock();
+            ActivePost(input, &poll);
+        }
+        wait = ActiveRun();
+#if RUNTIME_STATS
+        wait = SampleStats(wait);
+#endif
     }
-    if (result == pdPASS) {
-        clock_task_args_t clock_args = malloc(sizeof(*clock_args));
-        clock_args->clock_events = clock_events;
-        clock_args->display_mutex = display_mutex;
+}
+
+/* === Public function implementation ========================================================= */
+void TasksInit(clock_t clock, board_t board) {
+    static const input_event_t poll_event = {.source = INPUT_SOURCE_KEY, .kind = INPUT_KEY_POLL};
+    static const input_event_t scan_event = {.source = INPUT_SOURCE_TIMER, .kind = INPUT_SCAN};
+    static const input_event_t inactivity_event = {.source = INPUT_SOURCE_TIMER, .kind = INPUT_TIMER_INACTIVITY};
+    static const input_event_t sync_event = {.source = INPUT_SOURCE_TIMER, .kind = INPUT_CLOCK_SYNC};
+    input_task_args_t input_args = &memory.input_args;
+    refresh_task_args_t refresh_args = &memory.refresh_args;
+    clock_task_args_t clock_args = &memory.clock_args;
+    timekeeper_args_t timekeeper_args = &memory.timekeeper_args;
+    display_scan_t scan;
+    gesture_t gesture;
+    active_t input;
+    active_t refresh;
+    active_t clock_object;
+    active_t timekeeper;
+    TaskHandle_t active_task = NULL;
+
+#if TRACE
+    // Antes de crear las tareas, así el registro guarda sus nombres
+    BoardRunTimeInit();
+    TraceInit(TraceClock, RUNTIME_STATS_HZ);
+#endif
+    PROFILE_INIT();
+    ActiveInit(ActiveClock);
+    scan = DisplayScanCreate(&scan_config, DisplayDigits(board->display), DISPLAY_SCAN_BRIGHTNESS);
+    gesture = GestureCreate(&gesture_config, BOARD_KEYS);
+    input = ActiveCreate(INPUT_PRIORITY, InputHandler, input_args, memory.input_queue, INPUT_QUEUE_LENGTH);
+    refresh = ActiveCreate(REFRESH_PRIORITY, RefreshHandler, refresh_args, memory.refresh_queue, REFRESH_QUEUE_LENGTH);
+    clock_object = ActiveCreate(CLOCK_PRIORITY, ClockHandler, clock_args, memory.clock_queue, CLOCK_QUEUE_LENGTH);
+    timekeeper = ActiveCreate(TIMEKEEPER_PRIORITY, TimekeeperHandler, timekeeper_args, memory.timekeeper_queue,
+                              TIMEKEEPER_QUEUE_LENGTH);
+
+#if TRACE
+    TraceObjectName(INPUT_PRIORITY, "Input");
+    TraceObjectName(CLOCK_PRIORITY, "Clock");
+    TraceObjectName(REFRESH_PRIORITY, "Refresh");
+    TraceObjectName(TIMEKEEPER_PRIORITY, "Timekeeper");
+#endif
+    if (scan && gesture && input && refresh && clock_object && timekeeper) {
+        // Todos los objetos se crean antes de llenar los argumentos, porque cada uno encola eventos en otro
+        input_args->target = clock_object;
+        input_args->poll = ActiveTimerCreate(input, &poll_event);
+        input_args->keypad = board->keypad;
+        input_args->gesture = gesture;
+        input_args->encoder = board->encoder;
+
+        refresh_args->scan_timer = ActiveTimerCreate(refresh, &scan_event);
+        refresh_args->inactivity = ActiveTimerCreate(clock_object, &inactivity_event);
+        refresh_args->board = board;
+        refresh_args->clock = clock;
+        refresh_args->scan = scan;
+        refresh_args->monitor = ScanMonitorCreate(&monitor_config);
+        refresh_args->level = SCAN_MONITOR_OK;
+        refresh_args->period = DisplayScanPeriod(scan);
+        refresh_args->last_tick = xTaskGetTickCount();
+        refresh_args->pending_ms = 0;
+
         clock_args->board = board;
         clock_args->clock = clock;
-        result = xTaskCreate(ClockTask, "ClockTask", CLOCK_TASK_STACK_SIZE, clock_args, tskIDLE_PRIORITY + 3, NULL);
+        clock_args->self = clock_object;
+        clock_args->display = refresh;
+        clock_args->scan = scan;
+        clock_args->timekeeper = timekeeper;
+
+        timekeeper_args->clock = clock;
+        timekeeper_args->counter = ActiveClock;
+        timekeeper_args->timer = ActiveTimerCreate(timekeeper, &sync_event);
+        timekeeper_args->target = clock_object;
+        timekeeper_args->changes = ClockViewChanges(clock_args);
     }
-    if (result == pdPASS) {
-        refresh_task_args_t refresh_args = malloc(sizeof(*refresh_args));
-        refresh_args->display_mutex = display_mutex;
-        refresh_args->board = board;
-        refresh_args->clock = clock;
-        refresh_args->clock_events = clock_events;
-        result = xTaskCreate(RefreshDisplay, "Refresh", REFRESH_STACK_SIZE, refresh_args, tskIDLE_PRIORITY + 2, NULL);
+    if (input_args->poll && refresh_args->scan_timer && refresh_args->inactivity && timekeeper_args->timer) {
+        // El tiempo de inactividad arranca recién con la primera actividad, y la hora toma su referencia enseguida
+        ActiveTimerStart(refresh_args->scan_timer, refresh_args->period, refresh_args->period);
+        ActiveTimerStart(timekeeper_args->timer, 0, 0);
+        ClockStart(clock_args);
+        active_task = xTaskCreateStatic(ActiveTask, "Active", ACTIVE_TASK_STACK_SIZE, input, tskIDLE_PRIORITY + 1,
+                                        memory.active_stack, &memory.active_task);
     }
-
-    if (result != pdPASS) {
-        error_task_args_t error_args = malloc(sizeof(*error_args));
+    if (active_task != NULL) {
+        KeypadStart(board->keypad, &keypad_config, InputNotifyFromIsr, active_task);
+        if (board->encoder != NULL) {
+            EncoderStart(board->encoder, &encoder_config, InputNotifyFromIsr, active_task);
+        }
+#if SCAN_WATCHDOG
+        // Lo alimenta cada barrido, así también reinicia si la tarea de los objetos activos se cuelga
+        BoardWatchdogStart();
+#endif
+    } else {
+        error_task_args_t error_args = &memory.error_args;
         error_args->board = board;
-        xTaskCreate(Blinking, "Baliza", configMINIMAL_STACK_SIZE, error_args, tskIDLE_PRIORITY + 1, NULL);
+        xTaskCreateStatic(Blinking, "Baliza", configMINIMAL_STACK_SIZE, error_args, tskIDLE_PRIORITY + 1,
+                          memory.error_stack, &memory.error_task);
     }
 }
+
+void vApplicationGetIdleTaskMemory(StaticTask_t ** task, StackType_t ** stack, uint32_t * stack_size) {
+    *task = &memory.idle_task;
+    *stack = memory.idle_stack;
+    *stack_size = configMINIMAL_STACK_SIZE;
+}
 /* === End of documentation ==================================================================== */
 
 /** @} End of module definition for doxygen */
\ No newline at end of file
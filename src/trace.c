@@ -0,0 +1,128 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, María Ayelén Vega Caro <ayelenvegacaro@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file  trace.c
+ ** @brief Registro de eventos del núcleo en un anillo en RAM
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+#include "trace.h"
+#include <stddef.h>
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+#define TRACE_MASK (TRACE_RECORDS - 1)
+
+_Static_assert((TRACE_RECORDS & TRACE_MASK) == 0, "TRACE_RECORDS tiene que ser una potencia de dos");
+_Static_assert(sizeof(trace_record_t) == 8, "Los registros se vuelcan y se leen en la computadora con 8 bytes");
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+/**
+ * @brief Bloquea las interrupciones, así un registro escrito desde una interrupción no pisa a otro a medio escribir
+ *
+ * @return uint32_t Estado anterior de las interrupciones
+ */
+static inline uint32_t TraceLock(void);
+
+/**
+ * @brief Devuelve las interrupciones al estado anterior
+ *
+ * @param state Estado que devolvió TraceLock
+ */
+static inline void TraceUnlock(uint32_t state);
+
+/**
+ * @brief Copia un nombre en la tabla, cortándolo si es muy largo
+ *
+ * @param table Tabla de nombres
+ * @param id Posición en la tabla
+ * @param name Nombre
+ */
+static void TraceCopyName(char table[TRACE_NAMES][TRACE_NAME_LENGTH], uint8_t id, const char * name);
+
+/* === Private variable definitions ================================================================================ */
+static trace_clock_t trace_clock;
+static trace_buffer_t trace;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+static inline uint32_t TraceLock(void) {
+    uint32_t state = 0;
+#if defined(__ARM_ARCH)
+    __asm volatile("mrs %0, primask\n cpsid i" : "=r"(state) : : "memory");
+#endif
+    return state;
+}
+
+static inline void TraceUnlock(uint32_t state) {
+#if defined(__ARM_ARCH)
+    __asm volatile("msr primask, %0" : : "r"(state) : "memory");
+#else
+    (void)state;
+#endif
+}
+
+static void TraceCopyName(char table[TRACE_NAMES][TRACE_NAME_LENGTH], uint8_t id, const char * name) {
+    if (id < TRACE_NAMES && name != NULL) {
+        strncpy(table[id], name, TRACE_NAME_LENGTH - 1);
+        table[id][TRACE_NAME_LENGTH - 1] = 0;
+    }
+}
+
+/* === Public function implementation ============================================================================== */
+void TraceInit(trace_clock_t clock, uint32_t hz) {
+    memset(&trace, 0, sizeof(trace));
+    trace.magic = TRACE_MAGIC;
+    trace.hz = hz;
+    trace_clock = clock;
+}
+
+void TraceRecord(trace_kind_t kind, uint8_t id, uint16_t arg) {
+    trace_record_t * record;
+    uint32_t state;
+
+    if (trace_clock == NULL) {
+        return;
+    }
+    state = TraceLock();
+    record = &trace.records[trace.written & TRACE_MASK];
+    record->timestamp = trace_clock();
+    record->kind = (uint8_t)kind;
+    record->id = id;
+    record->arg = arg;
+    trace.written++;
+    TraceUnlock(state);
+}
+
+void TraceTaskName(uint8_t id, const char * name) {
+    TraceCopyName(trace.tasks, id, name);
+}
+
+void TraceObjectName(uint8_t id, const char * name) {
+    TraceCopyName(trace.objects, id, name);
+}
+
+const trace_buffer_t * TraceGetBuffer(void) {
+    return &trace;
+}
+
+/* === End of documentation ======================================================================================== */
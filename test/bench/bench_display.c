@@ -0,0 +1,218 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, María Ayelén Vega Caro <ayelenvegacaro@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file  bench_display.c
+ ** @brief Medición en el host del costo de DisplayRefresh para cada configuración de parpadeo y cantidad de dígitos
+ **
+ ** Informa nanosegundos e instrucciones por llamada, y para 4, 6 y 8 dígitos el costo por segundo con el período que
+ ** elige el planificador de barrido. Las instrucciones se leen con perf_event_open, si el sistema no
+ ** lo permite se informa solamente el tiempo. Se compila y ejecuta con `make bench`.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "display.h"
+#include "display_scan.h"
+#include "config.h"
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#endif
+
+/* === Macros definitions ========================================================================================== */
+#define BENCH_DIGITS     4       //!< Cantidad de dígitos de la pantalla
+#define BENCH_ITERATIONS 1000000 //!< Cantidad de llamadas a DisplayRefresh por configuración
+#define BENCH_TIME_ON    200     //!< Mismo valor de parpadeo que usa ClockTask
+
+/* === Private data type declarations ============================================================================== */
+//! Resultado de una medición
+typedef struct bench_result_s {
+    double ns;           //!< Nanosegundos por llamada
+    double instructions; //!< Instrucciones por llamada, negativo si no se pudieron medir
+} bench_result_t;
+
+//! Configuración de parpadeo que se quiere medir
+typedef struct bench_case_s {
+    const char * name;
+    bool flash_digits;
+    bool flash_points;
+    uint8_t point_mask;
+} bench_case_t;
+
+/* === Private function declarations =============================================================================== */
+//! Funciones vacías del driver, para medir solamente la lógica del display
+static void BenchDigitsTurnOff(void);
+static void BenchSegmentsUpdate(uint8_t segments);
+static void BenchDigitsTurnOn(uint8_t digit);
+
+/**
+ * @brief Abre el contador de instrucciones del proceso
+ *
+ * @return int Descriptor del contador, o -1 si no está disponible
+ */
+static int InstructionsOpen(void);
+
+/**
+ * @brief Lee el contador de instrucciones
+ *
+ * @param fd Descriptor del contador
+ * @return uint64_t Instrucciones ejecutadas desde que se abrió el contador
+ */
+static uint64_t InstructionsRead(int fd);
+
+/**
+ * @brief Mide el costo de DisplayRefresh sobre un display ya configurado
+ *
+ * @param display Display a medir
+ * @param counter Descriptor del contador de instrucciones
+ * @return bench_result_t Costo por llamada
+ */
+static bench_result_t BenchRefresh(display_t display, int counter);
+
+/* === Private variable definitions ================================================================================ */
+static volatile uint8_t sink; //!< Evita que el compilador elimine las llamadas al driver
+
+static const struct display_driver_s driver = {
+    .DigitsTurnOff = BenchDigitsTurnOff,
+    .SegmentsUpdate = BenchSegmentsUpdate,
+    .DigitsTurnOn = BenchDigitsTurnOn,
+};
+
+static const struct display_scan_config_s scan_config = {
+    .flicker_free_hz = DISPLAY_SCAN_FLICKER_FREE_HZ,
+    .idle_divider = DISPLAY_SCAN_IDLE_DIVIDER,
+};
+
+static const uint8_t digit_counts[] = {4, 6, 8};
+
+static const bench_case_t cases[] = {
+    {"sin parpadeo", false, false, 0x00},
+    {"digitos", true, false, 0x00},
+    {"puntos", false, true, 0x02},
+    {"digitos y puntos", true, true, 0x0F},
+};
+
+/* === Private function definitions ================================================================================ */
+static void BenchDigitsTurnOff(void) {
+    sink = 0;
+}
+
+static void BenchSegmentsUpdate(uint8_t segments) {
+    sink = segments;
+}
+
+static void BenchDigitsTurnOn(uint8_t digit) {
+    sink = digit;
+}
+
+static int InstructionsOpen(void) {
+#ifdef __linux__
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.size = sizeof(attr);
+    attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    return (int)syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+#else
+    return -1;
+#endif
+}
+
+static uint64_t InstructionsRead(int fd) {
+    uint64_t count = 0;
+    if (fd < 0 || read(fd, &count, sizeof(count)) != sizeof(count)) {
+        count = 0;
+    }
+    return count;
+}
+
+static bench_result_t BenchRefresh(display_t display, int counter) {
+    struct timespec start, end;
+    bench_result_t result;
+
+    uint64_t instructions = InstructionsRead(counter);
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (uint32_t n = 0; n < BENCH_ITERATIONS; n++) {
+        DisplayRefresh(display);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    instructions = InstructionsRead(counter) - instructions;
+
+    result.ns = ((end.tv_sec - start.tv_sec) * 1e9 + (end.tv_nsec - start.tv_nsec)) / BENCH_ITERATIONS;
+    result.instructions = counter >= 0 ? (double)instructions / BENCH_ITERATIONS : -1;
+    return result;
+}
+
+/* === Public function implementation ============================================================================== */
+int main(void) {
+    uint8_t value[DISPLAY_MAX_DIGITS] = {1, 2, 3, 4, 5, 6, 7, 8};
+    int counter = InstructionsOpen();
+
+    printf("%-20s %12s %16s\n", "configuracion", "ns/refresh", "instr/refresh");
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        display_t display = DisplayCreate(BENCH_DIGITS, &driver);
+
+        DisplayWrite(display, value, BENCH_DIGITS);
+        if (cases[i].flash_digits) {
+            DisplayFlashDigits(display, 0, 1, BENCH_TIME_ON);
+        }
+        if (cases[i].flash_points) {
+            DisplayFlashPoint(display, cases[i].point_mask, BENCH_TIME_ON);
+        }
+
+        bench_result_t result = BenchRefresh(display, counter);
+        if (result.instructions >= 0) {
+            printf("%-20s %12.2f %16.1f\n", cases[i].name, result.ns, result.instructions);
+        } else {
+            printf("%-20s %12.2f %16s\n", cases[i].name, result.ns, "n/d");
+        }
+    }
+
+    // El costo por segundo depende de cuántas veces por segundo despierta la tarea de refresco
+    printf("\n%-8s %10s %10s %12s %10s %16s\n", "digitos", "periodo ms", "Hz/digito", "refresh/s", "us/s",
+           "instr/s");
+    for (size_t i = 0; i < sizeof(digit_counts) / sizeof(digit_counts[0]); i++) {
+        display_t display = DisplayCreate(digit_counts[i], &driver);
+        display_scan_t scan = DisplayScanCreate(&scan_config, digit_counts[i], DISPLAY_SCAN_BRIGHTNESS);
+        uint32_t refreshes = 1000 / DisplayScanPeriod(scan);
+
+        DisplayWrite(display, value, digit_counts[i]);
+        DisplaySetPointEffect(display, 1, DisplayScanMsToSweeps(scan, 1000), 0);
+
+        bench_result_t result = BenchRefresh(display, counter);
+        if (result.instructions >= 0) {
+            printf("%-8u %10u %10u %12u %10.2f %16.0f\n", digit_counts[i], DisplayScanPeriod(scan),
+                   DisplayScanRefreshRate(scan), refreshes, result.ns * refreshes / 1000,
+                   result.instructions * refreshes);
+        } else {
+            printf("%-8u %10u %10u %12u %10.2f %16s\n", digit_counts[i], DisplayScanPeriod(scan),
+                   DisplayScanRefreshRate(scan), refreshes, result.ns * refreshes / 1000, "n/d");
+        }
+    }
+    return 0;
+}
+
+/* === End of documentation ======================================================================================== */
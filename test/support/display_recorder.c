@@ -0,0 +1,110 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, María Ayelén Vega Caro <ayelenvegacaro@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file  display_recorder.c
+ ** @brief Driver de display simulado que graba cada llamada en una traza, para comparar con trazas de referencia
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+#include "display_recorder.h"
+#include <stdio.h>
+
+/* === Macros definitions ========================================================================================== */
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+/**
+ * @brief Agrega una entrada a la traza
+ *
+ * @param entry Entrada que se quiere agregar
+ */
+static void DisplayRecorderAppend(uint16_t entry);
+
+//! Funciones del driver simulado
+static void RecorderDigitsTurnOff(void);
+static void RecorderSegmentsUpdate(uint8_t segments);
+static void RecorderDigitsTurnOn(uint8_t digit);
+
+/* === Private variable definitions ================================================================================ */
+static uint16_t trace[DISPLAY_TRACE_SIZE];
+static uint16_t size;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+static void DisplayRecorderAppend(uint16_t entry) {
+    if (size < DISPLAY_TRACE_SIZE) {
+        trace[size++] = entry;
+    }
+}
+
+static void RecorderDigitsTurnOff(void) {
+    DisplayRecorderAppend(TRACE_OFF());
+}
+
+static void RecorderSegmentsUpdate(uint8_t segments) {
+    DisplayRecorderAppend(TRACE_SEGMENTS(segments));
+}
+
+static void RecorderDigitsTurnOn(uint8_t digit) {
+    DisplayRecorderAppend(TRACE_ON(digit));
+}
+
+/* === Public function implementation ============================================================================== */
+display_driver_t DisplayRecorderCreate(void) {
+    static const struct display_driver_s driver = {
+        .DigitsTurnOff = RecorderDigitsTurnOff,
+        .SegmentsUpdate = RecorderSegmentsUpdate,
+        .DigitsTurnOn = RecorderDigitsTurnOn,
+    };
+    DisplayRecorderClear();
+    return &driver;
+}
+
+void DisplayRecorderClear(void) {
+    size = 0;
+}
+
+const uint16_t * DisplayRecorderTrace(void) {
+    return trace;
+}
+
+uint16_t DisplayRecorderSize(void) {
+    return size;
+}
+
+uint16_t DisplayRecorderCompare(const uint16_t * expected, uint16_t count) {
+    uint16_t index = 0;
+    while (index < count && index < size && expected[index] == trace[index]) {
+        index++;
+    }
+    return index;
+}
+
+void DisplayRecorderDescribe(char * buffer, uint16_t length, const uint16_t * expected, uint16_t index) {
+    if (index < size) {
+        snprintf(buffer, length, "Trace differs at %u: expected 0x%04X, got 0x%04X", index, expected[index],
+                 trace[index]);
+    } else {
+        snprintf(buffer, length, "Trace differs at %u", index);
+    }
+}
+
+/* === End of documentation ======================================================================================== */
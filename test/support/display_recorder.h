@@ -0,0 +1,116 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, María Ayelén Vega Caro <ayelenvegacaro@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef DISPLAY_RECORDER_H_
+#define DISPLAY_RECORDER_H_
+
+/** @file display_recorder.h
+ ** @brief Driver de display simulado que graba cada llamada en una traza, para comparar con trazas de referencia
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+#include <stdint.h>
+#include "display.h"
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+#define DISPLAY_TRACE_SIZE        256 ///< Cantidad máxima de llamadas que se pueden grabar
+
+//! Entradas de la traza: la operación en el byte alto y el argumento en el byte bajo
+#define TRACE_OFF()               ((uint16_t)0x0100)
+#define TRACE_SEGMENTS(segments)  ((uint16_t)(0x0200 | (uint8_t)(segments)))
+#define TRACE_ON(digit)           ((uint16_t)(0x0300 | (uint8_t)(digit)))
+
+//! Traza de un paso completo del multiplexado: apagar, cargar segmentos y encender el dígito
+#define TRACE_STEP(digit, segments) TRACE_OFF(), TRACE_SEGMENTS(segments), TRACE_ON(digit)
+
+/**
+ * @brief Compara la traza grabada con una traza de referencia
+ *
+ * Informa la primera posición distinta, que es más útil que un arreglo completo cuando falla un parpadeo.
+ */
+#define TEST_ASSERT_DISPLAY_TRACE(expected)                                                                            \
+    do {                                                                                                               \
+        char message[64];                                                                                              \
+        uint16_t size = sizeof(expected) / sizeof((expected)[0]);                                                      \
+        TEST_ASSERT_EQUAL_UINT16_MESSAGE(size, DisplayRecorderSize(), "Different trace length");                       \
+        uint16_t index = DisplayRecorderCompare((expected), size);                                                     \
+        DisplayRecorderDescribe(message, sizeof(message), (expected), index);                                          \
+        TEST_ASSERT_EQUAL_UINT16_MESSAGE(size, index, message);                                                        \
+    } while (0)
+
+/* === Public data type declarations =============================================================================== */
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+/**
+ * @brief Vacía la traza y devuelve el driver simulado
+ *
+ * @return display_driver_t Driver que graba cada llamada en la traza
+ */
+display_driver_t DisplayRecorderCreate(void);
+
+/**
+ * @brief Vacía la traza sin cambiar el driver
+ */
+void DisplayRecorderClear(void);
+
+/**
+ * @brief Devuelve las entradas grabadas
+ */
+const uint16_t * DisplayRecorderTrace(void);
+
+/**
+ * @brief Devuelve la cantidad de entradas grabadas
+ */
+uint16_t DisplayRecorderSize(void);
+
+/**
+ * @brief Compara la traza grabada con una traza de referencia
+ *
+ * @param expected Traza de referencia
+ * @param size Cantidad de entradas de la traza de referencia
+ * @return uint16_t Posición de la primera diferencia, o `size` si las `size` entradas de la referencia son iguales a
+ * las grabadas
+ */
+uint16_t DisplayRecorderCompare(const uint16_t * expected, uint16_t size);
+
+/**
+ * @brief Describe la diferencia en una posición de la traza para el mensaje de error
+ *
+ * @param buffer Donde se escribe el mensaje
+ * @param size Tamaño del buffer
+ * @param expected Traza de referencia
+ * @param index Posición de la diferencia
+ */
+void DisplayRecorderDescribe(char * buffer, uint16_t size, const uint16_t * expected, uint16_t index);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DISPLAY_RECORDER_H_ */
@@ -0,0 +1,106 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, María Ayelén Vega Caro <ayelenvegacaro@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file  encoder_sim.c
+ ** @brief Simulador de las señales de un encoder rotativo y de la interrupción que las lee
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+#include "encoder_sim.h"
+
+/* === Macros definitions ========================================================================================== */
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/* === Private variable definitions ================================================================================ */
+//! Estados de los pines en sentido horario, el canal A adelanta al B
+static const uint8_t SEQUENCE[4] = {
+    0,
+    ENCODER_CHANNEL_A,
+    ENCODER_CHANNEL_A | ENCODER_CHANNEL_B,
+    ENCODER_CHANNEL_B,
+};
+
+static encoder_t encoder;
+static uint32_t latency;
+static uint32_t service;
+static uint32_t position; //!< Flancos generados, se usan los dos bits menos significativos
+static uint64_t now;      //!< Tiempo simulado en microsegundos
+static uint64_t busy_until;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+/* === Public function implementation ============================================================================== */
+void EncoderSimCreate(encoder_t target, uint32_t latency_us, uint32_t service_us) {
+    encoder = target;
+    latency = latency_us;
+    service = (service_us > latency_us) ? service_us : latency_us;
+    position = 0;
+    now = 0;
+    busy_until = 0;
+}
+
+uint8_t EncoderSimState(void) {
+    return SEQUENCE[position & 3];
+}
+
+uint32_t EncoderSimTurn(int32_t transitions, uint32_t edge_us) {
+    uint32_t edges = (transitions < 0) ? (uint32_t)-transitions : (uint32_t)transitions;
+    uint32_t step = (transitions < 0) ? (uint32_t)-1 : 1;
+    uint64_t start = now + edge_us;
+    uint32_t next = 0;
+    uint32_t calls = 0;
+    uint64_t requested;
+    uint64_t read;
+
+    if (edges == 0) {
+        return 0;
+    }
+    while (next < edges) {
+        // El primer flanco sin atender pide la interrupción, que empieza cuando termina la anterior
+        requested = start + (uint64_t)next * edge_us;
+        position += step;
+        next++;
+        read = ((requested > busy_until) ? requested : busy_until) + latency;
+
+        // Los flancos que llegan antes de la lectura quedan juntos en el mismo pedido
+        while (next < edges && start + (uint64_t)next * edge_us <= read) {
+            position += step;
+            next++;
+        }
+        EncoderEdgeFromIsr(encoder, EncoderSimState(), (uint32_t)(read / 1000));
+        calls++;
+        busy_until = read - latency + service;
+    }
+    now = start + (uint64_t)(edges - 1) * edge_us;
+    if (busy_until > now) {
+        now = busy_until;
+    }
+    return calls;
+}
+
+void EncoderSimIdle(uint32_t ms) {
+    now += (uint64_t)ms * 1000;
+}
+
+/* === End of documentation ======================================================================================== */
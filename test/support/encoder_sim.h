@@ -0,0 +1,87 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, María Ayelén Vega Caro <ayelenvegacaro@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef ENCODER_SIM_H_
+#define ENCODER_SIM_H_
+
+/** @file encoder_sim.h
+ ** @brief Simulador de las señales de un encoder rotativo y de la interrupción que las lee, para las pruebas en el host
+ **
+ ** Genera los flancos en cuadratura a una velocidad dada y los entrega al encoder como lo haría la interrupción: un
+ ** flanco la pide, la rutina lee los pines un tiempo de latencia después y no atiende otro pedido hasta terminar. Los
+ ** flancos que llegan antes de la lectura se juntan en una sola, así que girando más rápido de lo que la interrupción
+ ** alcanza a atender se pierden pasos y se puede medir cuántos. El tiempo se cuenta en microsegundos.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+#include <stdint.h>
+#include "encoder.h"
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+//! Microsegundos entre flancos para girar a una cantidad de pasos por segundo
+#define ENCODER_SIM_EDGE_US(steps_per_second, transitions) (1000000UL / ((steps_per_second) * (transitions)))
+
+/* === Public data type declarations =============================================================================== */
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+/**
+ * @brief Reinicia el simulador con los dos canales en bajo y el tiempo en cero
+ *
+ * @param encoder Encoder que recibe los estados leídos por la interrupción
+ * @param latency_us Tiempo desde el pedido de interrupción hasta que la rutina lee los pines
+ * @param service_us Duración de la rutina, desde que empieza hasta que puede atender otro pedido
+ */
+void EncoderSimCreate(encoder_t encoder, uint32_t latency_us, uint32_t service_us);
+
+/**
+ * @brief Devuelve el estado actual de los pines, con ENCODER_CHANNEL_A y ENCODER_CHANNEL_B
+ */
+uint8_t EncoderSimState(void);
+
+/**
+ * @brief Gira el encoder a velocidad constante y atiende las interrupciones que generan los flancos
+ *
+ * @param transitions Flancos a generar, positivo en sentido horario y negativo en sentido antihorario
+ * @param edge_us Tiempo entre flancos
+ * @return uint32_t Cantidad de veces que se llamó a la rutina de atención
+ */
+uint32_t EncoderSimTurn(int32_t transitions, uint32_t edge_us);
+
+/**
+ * @brief Deja el encoder quieto durante un tiempo
+ *
+ * @param ms Milisegundos
+ */
+void EncoderSimIdle(uint32_t ms);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ENCODER_SIM_H_ */
@@ -0,0 +1,122 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, María Ayelén Vega Caro <ayelenvegacaro@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file  interrupt_sim.c
+ ** @brief Controlador de interrupciones simulado para inyectar flancos en pines desde las pruebas en el host
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+#include "interrupt_sim.h"
+#include <stddef.h>
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+/* === Private data type declarations ============================================================================== */
+//! Estado de una línea simulada
+struct interrupt_sim_line_s {
+    interrupt_sim_handler_t handler;
+    bool level;
+    bool enabled;
+    bool pending;
+};
+
+/* === Private function declarations =============================================================================== */
+/**
+ * @brief Atiende una línea si está habilitada o deja el flanco pendiente
+ *
+ * @param line Número de línea
+ */
+static void InterruptSimRaise(uint8_t line);
+
+/* === Private variable definitions ================================================================================ */
+static struct interrupt_sim_line_s lines[INTERRUPT_SIM_LINES];
+static uint32_t now;
+static uint32_t calls;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+static void InterruptSimRaise(uint8_t line) {
+    if (lines[line].enabled && lines[line].handler != NULL) {
+        lines[line].pending = false;
+        calls++;
+        lines[line].handler(line);
+    } else {
+        lines[line].pending = true;
+    }
+}
+
+/* === Public function implementation ============================================================================== */
+void InterruptSimCreate(void) {
+    memset(lines, 0, sizeof(lines));
+    now = 0;
+    calls = 0;
+}
+
+void InterruptSimConnect(uint8_t line, interrupt_sim_handler_t handler) {
+    if (line < INTERRUPT_SIM_LINES) {
+        lines[line].handler = handler;
+        lines[line].enabled = true;
+    }
+}
+
+void InterruptSimEnable(uint8_t line, bool enabled) {
+    if (line < INTERRUPT_SIM_LINES) {
+        lines[line].enabled = enabled;
+        if (enabled && lines[line].pending) {
+            InterruptSimRaise(line);
+        }
+    }
+}
+
+void InterruptSimSetLevel(uint8_t line, bool level) {
+    if (line < INTERRUPT_SIM_LINES && lines[line].level != level) {
+        lines[line].level = level;
+        InterruptSimRaise(line);
+    }
+}
+
+void InterruptSimBounce(uint8_t line, bool level, uint8_t bounces) {
+    for (uint8_t i = 0; i < bounces; i++) {
+        InterruptSimSetLevel(line, level);
+        InterruptSimAdvance(1);
+        InterruptSimSetLevel(line, !level);
+        InterruptSimAdvance(1);
+    }
+    InterruptSimSetLevel(line, level);
+}
+
+bool InterruptSimGetLevel(uint8_t line) {
+    return line < INTERRUPT_SIM_LINES && lines[line].level;
+}
+
+void InterruptSimAdvance(uint32_t ms) {
+    now += ms;
+}
+
+uint32_t InterruptSimNow(void) {
+    return now;
+}
+
+uint32_t InterruptSimCalls(void) {
+    return calls;
+}
+
+/* === End of documentation ======================================================================================== */
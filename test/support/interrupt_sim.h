@@ -0,0 +1,119 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, María Ayelén Vega Caro <ayelenvegacaro@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef INTERRUPT_SIM_H_
+#define INTERRUPT_SIM_H_
+
+/** @file interrupt_sim.h
+ ** @brief Controlador de interrupciones simulado para inyectar flancos en pines desde las pruebas en el host
+ **
+ ** Cada línea tiene un nivel y una rutina de atención que se llama en cada flanco, como un pin configurado para
+ ** interrumpir por ambos flancos. Las líneas deshabilitadas guardan el flanco pendiente y lo atienden al
+ ** habilitarlas. El tiempo avanza solamente cuando lo indica la prueba.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+#include <stdint.h>
+#include <stdbool.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+#define INTERRUPT_SIM_LINES 8 ///< Cantidad de líneas de interrupción simuladas
+
+/* === Public data type declarations =============================================================================== */
+//! Rutina de atención de una línea
+typedef void (*interrupt_sim_handler_t)(uint8_t line);
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+/**
+ * @brief Reinicia el controlador: todas las líneas en bajo, sin rutinas y el tiempo en cero
+ */
+void InterruptSimCreate(void);
+
+/**
+ * @brief Conecta y habilita la rutina de atención de una línea
+ *
+ * @param line Número de línea
+ * @param handler Rutina de atención
+ */
+void InterruptSimConnect(uint8_t line, interrupt_sim_handler_t handler);
+
+/**
+ * @brief Habilita o deshabilita una línea, al habilitarla se atiende el flanco pendiente
+ *
+ * @param line Número de línea
+ * @param enabled True para habilitarla
+ */
+void InterruptSimEnable(uint8_t line, bool enabled);
+
+/**
+ * @brief Cambia el nivel de una línea y llama a la rutina de atención si hubo un flanco
+ *
+ * @param line Número de línea
+ * @param level Nivel nuevo
+ */
+void InterruptSimSetLevel(uint8_t line, bool level);
+
+/**
+ * @brief Lleva una línea a un nivel con rebotes, un cambio por milisegundo
+ *
+ * @param line Número de línea
+ * @param level Nivel final
+ * @param bounces Cantidad de veces que vuelve al nivel anterior antes de quedar estable
+ */
+void InterruptSimBounce(uint8_t line, bool level, uint8_t bounces);
+
+/**
+ * @brief Devuelve el nivel de una línea, lo que leería la rutina de atención en el pin
+ *
+ * @param line Número de línea
+ */
+bool InterruptSimGetLevel(uint8_t line);
+
+/**
+ * @brief Avanza el tiempo simulado
+ *
+ * @param ms Milisegundos
+ */
+void InterruptSimAdvance(uint32_t ms);
+
+/**
+ * @brief Devuelve el tiempo simulado en milisegundos
+ */
+uint32_t InterruptSimNow(void);
+
+/**
+ * @brief Devuelve la cantidad de veces que se llamó a las rutinas de atención
+ */
+uint32_t InterruptSimCalls(void);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INTERRUPT_SIM_H_ */
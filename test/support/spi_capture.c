@@ -0,0 +1,82 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, María Ayelén Vega Caro <ayelenvegacaro@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file  spi_capture.c
+ ** @brief Puerto SPI simulado que captura los bytes enviados, para probar drivers de display en el host
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+#include "spi_capture.h"
+
+/* === Macros definitions ========================================================================================== */
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+/**
+ * @brief Guarda las palabras enviadas en el buffer de captura
+ *
+ * @param words Palabras de 16 bits enviadas
+ * @param count Cantidad de palabras
+ */
+static void SpiCaptureTransfer(const uint16_t * words, uint8_t count);
+
+/* === Private variable definitions ================================================================================ */
+static uint8_t stream[SPI_CAPTURE_SIZE];
+static uint16_t size;
+static uint16_t transfers;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+static void SpiCaptureTransfer(const uint16_t * words, uint8_t count) {
+    for (uint8_t i = 0; i < count && size + 2 <= SPI_CAPTURE_SIZE; i++) {
+        stream[size++] = (uint8_t)(words[i] >> 8);
+        stream[size++] = (uint8_t)(words[i] & 0xFF);
+    }
+    transfers++;
+}
+
+/* === Public function implementation ============================================================================== */
+max7219_spi_t SpiCaptureCreate(void) {
+    static const struct max7219_spi_s spi = {
+        .Transfer = SpiCaptureTransfer,
+    };
+    SpiCaptureClear();
+    return &spi;
+}
+
+void SpiCaptureClear(void) {
+    size = 0;
+    transfers = 0;
+}
+
+const uint8_t * SpiCaptureStream(void) {
+    return stream;
+}
+
+uint16_t SpiCaptureSize(void) {
+    return size;
+}
+
+uint16_t SpiCaptureTransfers(void) {
+    return transfers;
+}
+
+/* === End of documentation ======================================================================================== */
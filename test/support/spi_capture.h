@@ -0,0 +1,80 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, María Ayelén Vega Caro <ayelenvegacaro@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef SPI_CAPTURE_H_
+#define SPI_CAPTURE_H_
+
+/** @file spi_capture.h
+ ** @brief Puerto SPI simulado que captura los bytes enviados, para probar drivers de display en el host
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+#include <stdint.h>
+#include "max7219.h"
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+#define SPI_CAPTURE_SIZE 256 ///< Cantidad máxima de bytes que se pueden capturar
+
+/* === Public data type declarations =============================================================================== */
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+/**
+ * @brief Vacía la captura y devuelve el puerto SPI simulado
+ *
+ * @return max7219_spi_t Puerto SPI que guarda los bytes en el orden en que salen por el cable
+ */
+max7219_spi_t SpiCaptureCreate(void);
+
+/**
+ * @brief Vacía la captura sin cambiar el puerto
+ */
+void SpiCaptureClear(void);
+
+/**
+ * @brief Devuelve los bytes capturados desde la última vez que se vació la captura
+ *
+ * @return const uint8_t* Bytes enviados, el byte más significativo de cada palabra primero
+ */
+const uint8_t * SpiCaptureStream(void);
+
+/**
+ * @brief Devuelve la cantidad de bytes capturados
+ */
+uint16_t SpiCaptureSize(void);
+
+/**
+ * @brief Devuelve la cantidad de transferencias realizadas
+ */
+uint16_t SpiCaptureTransfers(void);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SPI_CAPTURE_H_ */
@@ -0,0 +1,408 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, María Ayelén Vega Caro <ayelenvegacaro@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+
+PRUEBAS A REALIZAR
+- Sin eventos ni temporizadores no se atiende nada y no hay vencimiento
+- Los eventos de un objeto se atienden en el orden en que se encolaron
+- Se atiende primero el objeto de mayor prioridad aunque se haya encolado después
+- Un evento encolado desde una función se atiende recién cuando la función termina
+- Con la cola llena el evento se pierde y se cuenta
+- Se registra la máxima ocupación de cada cola
+- Un temporizador de una vez vence una sola vez y el tiempo de espera apunta a él
+- Un temporizador periódico no acumula el retraso con el que se atiende
+- Un temporizador atendido tarde saltea los vencimientos perdidos
+- Un temporizador detenido no vence
+- Volver a arrancar un temporizador que está corriendo reemplaza su vencimiento
+- Un temporizador largo baja por los niveles de la rueda y vence exactamente a tiempo
+- Temporizadores con vencimientos en distintos niveles vencen en orden y a tiempo
+- Un temporizador más largo que la rueda vence igual a tiempo
+- Un temporizador agregado después de uno más largo que la rueda adelanta el tiempo de espera
+- Los temporizadores funcionan cuando el contador de tiempo desborda
+- Se mide la mayor latencia entre que se encola un evento y que se atiende
+- Se cuentan las veces que se despierta el núcleo
+- Parámetros inválidos
+
+*********************************************************************************************************************/
+
+/** @file  test_active.c
+ ** @brief Pruebas del núcleo de objetos activos con un reloj simulado
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+#include "unity.h"
+#include "active.h"
+
+/* === Macros definitions ========================================================================================== */
+#define QUEUE_LENGTH 4 //!< Eventos que entran en la cola de cada objeto
+
+/* === Private data type declarations ============================================================================== */
+//! Evento atendido por un objeto
+typedef struct record_s {
+    uint8_t object;
+    uint8_t code;
+    uint32_t timestamp;
+} record_t;
+
+/* === Private function declarations ===============================================================================*/
+/**
+ * @brief Reloj simulado del núcleo
+ */
+static uint32_t Clock(void);
+
+/**
+ * @brief Guarda cada evento atendido con el número de objeto que recibe como contexto
+ *
+ * El código 0xFF encola un evento en el objeto rápido, y el código 0xFE simula que atender tarda 5 ms.
+ */
+static void Handler(const input_event_t * event, void * context);
+
+/**
+ * @brief Encola un evento con un código en un objeto
+ *
+ * @param object Objeto que recibe el evento
+ * @param code Código del evento
+ */
+static bool Post(active_t object, uint8_t code);
+
+/* === Private variable definitions ================================================================================ */
+static uint32_t now;
+static active_slot_t slow_queue[QUEUE_LENGTH];
+static active_slot_t fast_queue[QUEUE_LENGTH];
+static active_t slow;
+static active_t fast;
+static record_t records[16];
+static uint8_t record_count;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+static uint32_t Clock(void) {
+    return now;
+}
+
+static void Handler(const input_event_t * event, void * context) {
+    if (event->code == 0xFF) {
+        Post(fast, 0x10);
+    }
+    if (event->code == 0xFE) {
+        now += 5;
+    }
+    if (record_count < sizeof(records) / sizeof(records[0])) {
+        records[record_count].object = (uint8_t)(uintptr_t)context;
+        records[record_count].code = event->code;
+        records[record_count].timestamp = event->timestamp;
+        record_count++;
+    }
+}
+
+static bool Post(active_t object, uint8_t code) {
+    input_event_t event = {.timestamp = now, .code = code};
+    return ActivePost(object, &event);
+}
+
+/* === Public function implementation ============================================================================== */
+void setUp(void) {
+    now = 1000;
+    ActiveInit(Clock);
+    slow = ActiveCreate(1, Handler, (void *)1, slow_queue, QUEUE_LENGTH);
+    fast = ActiveCreate(2, Handler, (void *)2, fast_queue, QUEUE_LENGTH);
+    record_count = 0;
+}
+
+// Sin eventos ni temporizadores no se atiende nada y no hay vencimiento
+void test_idle(void) {
+    TEST_ASSERT_EQUAL_UINT32(ACTIVE_NO_DEADLINE, ActiveRun());
+    TEST_ASSERT_EQUAL_UINT8(0, record_count);
+}
+
+// Los eventos de un objeto se atienden en el orden en que se encolaron
+void test_fifo_order(void) {
+    Post(slow, 1);
+    Post(slow, 2);
+    Post(slow, 3);
+    ActiveRun();
+    TEST_ASSERT_EQUAL_UINT8(3, record_count);
+    TEST_ASSERT_EQUAL_UINT8(1, records[0].code);
+    TEST_ASSERT_EQUAL_UINT8(2, records[1].code);
+    TEST_ASSERT_EQUAL_UINT8(3, records[2].code);
+}
+
+// Se atiende primero el objeto de mayor prioridad aunque se haya encolado después
+void test_priority_order(void) {
+    Post(slow, 1);
+    Post(fast, 2);
+    ActiveRun();
+    TEST_ASSERT_EQUAL_UINT8(2, record_count);
+    TEST_ASSERT_EQUAL_UINT8(2, records[0].object);
+    TEST_ASSERT_EQUAL_UINT8(1, records[1].object);
+}
+
+// Un evento encolado desde una función se atiende recién cuando la función termina
+void test_run_to_completion(void) {
+    Post(slow, 0xFF);
+    Post(slow, 1);
+    ActiveRun();
+    TEST_ASSERT_EQUAL_UINT8(3, record_count);
+    TEST_ASSERT_EQUAL_UINT8(0xFF, records[0].code);
+    // El objeto rápido pasa adelante del evento lento que ya estaba encolado
+    TEST_ASSERT_EQUAL_UINT8(0x10, records[1].code);
+    TEST_ASSERT_EQUAL_UINT8(1, records[2].code);
+}
+
+// Con la cola llena el evento se pierde y se cuenta
+void test_queue_full(void) {
+    active_stats_t stats;
+
+    for (uint8_t code = 0; code < QUEUE_LENGTH; code++) {
+        TEST_ASSERT_TRUE(Post(slow, code));
+    }
+    TEST_ASSERT_FALSE(Post(slow, QUEUE_LENGTH));
+    ActiveGetStats(slow, &stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.dropped);
+    ActiveRun();
+    TEST_ASSERT_EQUAL_UINT8(QUEUE_LENGTH, record_count);
+    TEST_ASSERT_TRUE(Post(slow, 0));
+}
+
+// Se registra la máxima ocupación de cada cola
+void test_high_water(void) {
+    active_stats_t stats;
+
+    Post(slow, 1);
+    Post(slow, 2);
+    ActiveRun();
+    Post(slow, 3);
+    ActiveRun();
+    ActiveGetStats(slow, &stats);
+    TEST_ASSERT_EQUAL_UINT16(2, stats.high_water);
+    TEST_ASSERT_EQUAL_UINT32(3, stats.dispatched);
+}
+
+// Un temporizador de una vez vence una sola vez y el tiempo de espera apunta a él
+void test_one_shot_timer(void) {
+    input_event_t event = {.code = 7};
+    active_timer_t timer = ActiveTimerCreate(slow, &event);
+
+    ActiveTimerStart(timer, 50, 0);
+    TEST_ASSERT_EQUAL_UINT32(50, ActiveRun());
+    now += 30;
+    TEST_ASSERT_EQUAL_UINT32(20, ActiveRun());
+    TEST_ASSERT_EQUAL_UINT8(0, record_count);
+    now += 20;
+    TEST_ASSERT_EQUAL_UINT32(ACTIVE_NO_DEADLINE, ActiveRun());
+    TEST_ASSERT_EQUAL_UINT8(1, record_count);
+    TEST_ASSERT_EQUAL_UINT8(7, records[0].code);
+    TEST_ASSERT_EQUAL_UINT32(1050, records[0].timestamp);
+}
+
+// Un temporizador periódico no acumula el retraso con el que se atiende
+void test_periodic_timer_keeps_phase(void) {
+    input_event_t event = {.code = 7};
+    active_timer_t timer = ActiveTimerCreate(slow, &event);
+
+    ActiveTimerStart(timer, 10, 10);
+    now += 13;
+    TEST_ASSERT_EQUAL_UINT32(7, ActiveRun());
+    now += 7;
+    TEST_ASSERT_EQUAL_UINT32(10, ActiveRun());
+    TEST_ASSERT_EQUAL_UINT8(2, record_count);
+    TEST_ASSERT_EQUAL_UINT32(1010, records[0].timestamp);
+    TEST_ASSERT_EQUAL_UINT32(1020, records[1].timestamp);
+}
+
+// Un temporizador atendido tarde saltea los vencimientos perdidos
+void test_late_periodic_timer_skips_missed(void) {
+    input_event_t event = {.code = 7};
+    active_timer_t timer = ActiveTimerCreate(slow, &event);
+
+    ActiveTimerStart(timer, 10, 10);
+    now += 35;
+    TEST_ASSERT_EQUAL_UINT32(5, ActiveRun());
+    TEST_ASSERT_EQUAL_UINT8(1, record_count);
+}
+
+// Un temporizador detenido no vence
+void test_stopped_timer(void) {
+    input_event_t event = {.code = 7};
+    active_timer_t timer = ActiveTimerCreate(slow, &event);
+
+    ActiveTimerStart(timer, 10, 10);
+    ActiveTimerStop(timer);
+    now += 100;
+    TEST_ASSERT_EQUAL_UINT32(ACTIVE_NO_DEADLINE, ActiveRun());
+    TEST_ASSERT_EQUAL_UINT8(0, record_count);
+}
+
+// Volver a arrancar un temporizador que está corriendo reemplaza su vencimiento
+void test_restart_running_timer(void) {
+    input_event_t event = {.code = 7};
+    active_timer_t timer = ActiveTimerCreate(slow, &event);
+
+    ActiveTimerStart(timer, 100, 0);
+    ActiveTimerStart(timer, 30, 0);
+    TEST_ASSERT_EQUAL_UINT32(30, ActiveRun());
+    now += 30;
+    TEST_ASSERT_EQUAL_UINT32(ACTIVE_NO_DEADLINE, ActiveRun());
+    now += 100;
+    ActiveRun();
+    TEST_ASSERT_EQUAL_UINT8(1, record_count);
+    TEST_ASSERT_EQUAL_UINT32(1030, records[0].timestamp);
+}
+
+// Un temporizador largo baja por los niveles de la rueda y vence exactamente a tiempo
+void test_long_timer_is_exact(void) {
+    input_event_t event = {.code = 7};
+    active_timer_t timer = ActiveTimerCreate(slow, &event);
+
+    ActiveTimerStart(timer, 30000, 0);
+    TEST_ASSERT_EQUAL_UINT32(30000, ActiveRun());
+    now += 29999;
+    TEST_ASSERT_EQUAL_UINT32(1, ActiveRun());
+    TEST_ASSERT_EQUAL_UINT8(0, record_count);
+    now += 1;
+    ActiveRun();
+    TEST_ASSERT_EQUAL_UINT8(1, record_count);
+    TEST_ASSERT_EQUAL_UINT32(31000, records[0].timestamp);
+}
+
+// Temporizadores con vencimientos en distintos niveles vencen en orden y a tiempo
+void test_timers_in_all_levels(void) {
+    static const uint32_t delays[] = {1500, 5, 31, 32, 700, 1024, 20000, 33};
+    input_event_t event;
+    uint32_t wait;
+
+    for (uint8_t index = 0; index < sizeof(delays) / sizeof(delays[0]); index++) {
+        event.code = index;
+        ActiveTimerStart(ActiveTimerCreate(slow, &event), delays[index], 0);
+    }
+    // Se duerme siempre lo que indica el núcleo, así cada vencimiento se atiende sin retraso
+    for (wait = ActiveRun(); wait != ACTIVE_NO_DEADLINE; wait = ActiveRun()) {
+        now += wait;
+    }
+    TEST_ASSERT_EQUAL_UINT8(8, record_count);
+    for (uint8_t index = 0; index < record_count; index++) {
+        TEST_ASSERT_EQUAL_UINT32(1000 + delays[records[index].code], records[index].timestamp);
+        if (index > 0) {
+            TEST_ASSERT_GREATER_THAN_UINT32(records[index - 1].timestamp, records[index].timestamp);
+        }
+    }
+    // El núcleo despierta una vez al empezar y una por vencimiento, bajar de nivel no agrega despertares
+    TEST_ASSERT_EQUAL_UINT32(9, ActiveRuns());
+}
+
+// Un temporizador más largo que la rueda vence igual a tiempo
+void test_timer_beyond_wheel(void) {
+    input_event_t event = {.code = 7};
+    active_timer_t timer = ActiveTimerCreate(slow, &event);
+    uint32_t wait;
+
+    ActiveTimerStart(timer, 100000, 0);
+    for (wait = ActiveRun(); wait != ACTIVE_NO_DEADLINE; wait = ActiveRun()) {
+        now += wait;
+    }
+    TEST_ASSERT_EQUAL_UINT8(1, record_count);
+    TEST_ASSERT_EQUAL_UINT32(101000, records[0].timestamp);
+}
+
+// Un temporizador agregado después de uno más largo que la rueda adelanta el tiempo de espera
+void test_timer_after_beyond_wheel(void) {
+    input_event_t minute = {.code = 1};
+    input_event_t inactivity = {.code = 2};
+    active_timer_t first = ActiveTimerCreate(slow, &minute);
+    active_timer_t second = ActiveTimerCreate(slow, &inactivity);
+    uint32_t wait;
+
+    now = 0;
+    ActiveRun();
+    ActiveTimerStart(first, 60000, 0);
+    TEST_ASSERT_EQUAL_UINT32(60000, ActiveRun());
+    now = 5000;
+    TEST_ASSERT_EQUAL_UINT32(55000, ActiveRun());
+    ActiveTimerStart(second, 30000, 0);
+    TEST_ASSERT_EQUAL_UINT32(30000, ActiveRun());
+    for (wait = ActiveRun(); wait != ACTIVE_NO_DEADLINE; wait = ActiveRun()) {
+        now += wait;
+    }
+    TEST_ASSERT_EQUAL_UINT8(2, record_count);
+    TEST_ASSERT_EQUAL_UINT8(2, records[0].code);
+    TEST_ASSERT_EQUAL_UINT32(35000, records[0].timestamp);
+    TEST_ASSERT_EQUAL_UINT8(1, records[1].code);
+    TEST_ASSERT_EQUAL_UINT32(60000, records[1].timestamp);
+}
+
+// Los temporizadores funcionan cuando el contador de tiempo desborda
+void test_timer_wraps_around(void) {
+    input_event_t event = {.code = 7};
+    active_timer_t timer = ActiveTimerCreate(slow, &event);
+
+    now = UINT32_MAX - 10;
+    ActiveRun();
+    ActiveTimerStart(timer, 50, 2000);
+    TEST_ASSERT_EQUAL_UINT32(50, ActiveRun());
+    now += 50;
+    TEST_ASSERT_EQUAL_UINT32(2000, ActiveRun());
+    now += 2000;
+    ActiveRun();
+    TEST_ASSERT_EQUAL_UINT8(2, record_count);
+    TEST_ASSERT_EQUAL_UINT32(39, records[0].timestamp);
+    TEST_ASSERT_EQUAL_UINT32(2039, records[1].timestamp);
+}
+
+// Se mide la mayor latencia entre que se encola un evento y que se atiende
+void test_latency(void) {
+    active_stats_t stats;
+
+    Post(fast, 0xFE);
+    Post(slow, 1);
+    ActiveRun();
+    ActiveGetStats(fast, &stats);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.max_latency);
+    ActiveGetStats(slow, &stats);
+    TEST_ASSERT_EQUAL_UINT32(5, stats.max_latency);
+}
+
+// Se cuentan las veces que se despierta el núcleo
+void test_runs(void) {
+    ActiveRun();
+    ActiveRun();
+    TEST_ASSERT_EQUAL_UINT32(2, ActiveRuns());
+}
+
+// Parámetros inválidos
+void test_invalid_parameters(void) {
+    static active_slot_t queue[QUEUE_LENGTH];
+    input_event_t event = {0};
+
+    TEST_ASSERT_NULL(ActiveCreate(1, Handler, NULL, queue, QUEUE_LENGTH));
+    TEST_ASSERT_NULL(ActiveCreate(3, NULL, NULL, queue, QUEUE_LENGTH));
+    TEST_ASSERT_NULL(ActiveCreate(3, Handler, NULL, NULL, QUEUE_LENGTH));
+    TEST_ASSERT_NULL(ActiveCreate(3, Handler, NULL, queue, 0));
+    TEST_ASSERT_NOT_NULL(ActiveCreate(3, Handler, NULL, queue, QUEUE_LENGTH));
+    TEST_ASSERT_NOT_NULL(ActiveCreate(4, Handler, NULL, queue, QUEUE_LENGTH));
+    TEST_ASSERT_NULL(ActiveCreate(5, Handler, NULL, queue, QUEUE_LENGTH));
+    TEST_ASSERT_FALSE(ActivePost(NULL, &event));
+    TEST_ASSERT_NULL(ActiveTimerCreate(NULL, &event));
+    for (uint8_t timer = 0; timer < ACTIVE_MAX_TIMERS; timer++) {
+        TEST_ASSERT_NOT_NULL(ActiveTimerCreate(slow, &event));
+    }
+    TEST_ASSERT_NULL(ActiveTimerCreate(slow, &event));
+    ActiveInit(NULL);
+    TEST_ASSERT_NULL(ActiveCreate(1, Handler, NULL, queue, QUEUE_LENGTH));
+}
+
+/* === End of documentation ======================================================================================== */
@@ -38,6 +38,24 @@ Alarma
 -Hacer sonar la alarma y cancelarla hasta el dia siguiente
 -Setear alarma con hora invalida
 
+Cambios
+- Al crear el reloj no hay cambios
+- Al avanzar un segundo cambian los segundos pero no los minutos
+- Al pasar al minuto siguiente cambian los segundos y los minutos
+- Consultar los cambios los borra
+- Al ajustar la hora cambian los segundos y los minutos
+- Se informa cuando la alarma empieza a sonar y cuando se pospone
+- En una hora sin actividad hay 60 cambios de minutos y 3600 de segundos
+- Se calculan los ticks que faltan hasta el próximo segundo y el próximo minuto
+- Se calculan los ticks que faltan hasta que suene la alarma
+- Sin alarma habilitada o con la alarma sonando no hay cambio previsto
+
+Sincronización
+- La primera sincronización solamente toma la referencia del contador
+- Sincronizar avanza los ticks transcurridos aunque el contador desborde
+- Con la tarea que sincroniza demorada al azar durante 25 horas el reloj no atrasa
+- Una sincronización tardía no saltea la alarma
+
 *********************************************************************************************************************/
 
 /** @file  test_reloj.c
@@ -350,6 +368,204 @@ void test_postpone_alarm_disable_and_enable(void) {
     TEST_ASSERT_TRUE(ClockIsAlarmActive(clock));
 }
 
+// Al crear el reloj no hay cambios
+void test_no_changes_after_create(void) {
+    TEST_ASSERT_EQUAL_UINT8(0, ClockTakeChanges(clock));
+}
+
+// Al avanzar un segundo cambian los segundos pero no los minutos
+void test_second_changes_seconds(void) {
+    static const clock_time_t new_time = {.time = {.hours = {1, 2}, .minutes = {3, 0}, .seconds = {4, 0}}};
+
+    ClockSetTime(clock, &new_time);
+    ClockTakeChanges(clock);
+    SimulateSeconds(clock, 1);
+    TEST_ASSERT_EQUAL_UINT8(CLOCK_CHANGED_SECONDS, ClockTakeChanges(clock));
+}
+
+// Al pasar al minuto siguiente cambian los segundos y los minutos
+void test_minute_changes_minutes(void) {
+    static const clock_time_t new_time = {.time = {.hours = {1, 2}, .minutes = {3, 0}, .seconds = {9, 5}}};
+
+    ClockSetTime(clock, &new_time);
+    ClockTakeChanges(clock);
+    SimulateSeconds(clock, 1);
+    TEST_ASSERT_EQUAL_UINT8(CLOCK_CHANGED_SECONDS | CLOCK_CHANGED_MINUTES, ClockTakeChanges(clock));
+}
+
+// Consultar los cambios los borra
+void test_take_changes_clears_them(void) {
+    SimulateSeconds(clock, 1);
+    TEST_ASSERT_EQUAL_UINT8(CLOCK_CHANGED_SECONDS, ClockTakeChanges(clock));
+    TEST_ASSERT_EQUAL_UINT8(0, ClockTakeChanges(clock));
+}
+
+// Al ajustar la hora cambian los segundos y los minutos
+void test_set_time_changes_everything(void) {
+    static const clock_time_t new_time = {.time = {.hours = {1, 2}, .minutes = {3, 0}, .seconds = {4, 5}}};
+
+    ClockSetTime(clock, &new_time);
+    TEST_ASSERT_EQUAL_UINT8(CLOCK_CHANGED_SECONDS | CLOCK_CHANGED_MINUTES, ClockTakeChanges(clock));
+}
+
+// Se informa cuando la alarma empieza a sonar y cuando se pospone
+void test_alarm_changes(void) {
+    static const clock_time_t new_alarm = {.time = {.hours = {1, 2}, .minutes = {0, 3}, .seconds = {0, 0}}};
+    static const clock_time_t current_time = {.time = {.hours = {1, 2}, .minutes = {9, 2}, .seconds = {9, 5}}};
+    uint8_t changes;
+
+    ClockSetTime(clock, &current_time);
+    ClockSetAlarm(clock, &new_alarm);
+    ClockTakeChanges(clock);
+    SimulateSeconds(clock, 1);
+    changes = ClockTakeChanges(clock);
+    TEST_ASSERT_EQUAL_UINT8(CLOCK_CHANGED_SECONDS | CLOCK_CHANGED_MINUTES | CLOCK_CHANGED_ALARM, changes);
+    ClockPostponeAlarm(clock);
+    TEST_ASSERT_EQUAL_UINT8(CLOCK_CHANGED_ALARM, ClockTakeChanges(clock));
+    ClockPostponeAlarm(clock);
+    TEST_ASSERT_EQUAL_UINT8(0, ClockTakeChanges(clock));
+}
+
+// En una hora sin actividad hay 60 cambios de minutos y 3600 de segundos
+void test_changes_per_hour(void) {
+    uint32_t minutes = 0;
+    uint32_t seconds = 0;
+    uint8_t changes;
+
+    for (uint32_t second = 0; second < 3600; second++) {
+        SimulateSeconds(clock, 1);
+        changes = ClockTakeChanges(clock);
+        minutes += (changes & CLOCK_CHANGED_MINUTES) ? 1 : 0;
+        seconds += (changes & CLOCK_CHANGED_SECONDS) ? 1 : 0;
+    }
+    TEST_ASSERT_EQUAL_UINT32(60, minutes);
+    TEST_ASSERT_EQUAL_UINT32(3600, seconds);
+}
+
+// Se calculan los ticks que faltan hasta el próximo segundo y el próximo minuto
+void test_ticks_to_next_second_and_minute(void) {
+    static const clock_time_t new_time = {.time = {.hours = {1, 2}, .minutes = {3, 0}, .seconds = {8, 5}}};
+    uint32_t ticks;
+
+    ClockSetTime(clock, &new_time);
+    ClockNewTick(clock);
+    TEST_ASSERT_EQUAL_UINT32(CLOCK_TICK_PER_SECONDS - 1, ClockTicksToChange(clock, CLOCK_CHANGED_SECONDS));
+    TEST_ASSERT_EQUAL_UINT32(CLOCK_TICK_PER_SECONDS - 1 + CLOCK_TICK_PER_SECONDS,
+                             ClockTicksToChange(clock, CLOCK_CHANGED_MINUTES));
+    TEST_ASSERT_EQUAL_UINT32(CLOCK_TICK_PER_SECONDS - 1,
+                             ClockTicksToChange(clock, CLOCK_CHANGED_SECONDS | CLOCK_CHANGED_MINUTES));
+    ticks = ClockTicksToChange(clock, CLOCK_CHANGED_MINUTES);
+    ClockTakeChanges(clock);
+    for (uint32_t tick = 1; tick < ticks; tick++) {
+        ClockNewTick(clock);
+    }
+    TEST_ASSERT_EQUAL_UINT8(0, ClockTakeChanges(clock) & CLOCK_CHANGED_MINUTES);
+    ClockNewTick(clock);
+    TEST_ASSERT_EQUAL_UINT8(CLOCK_CHANGED_SECONDS | CLOCK_CHANGED_MINUTES, ClockTakeChanges(clock));
+}
+
+// Se calculan los ticks que faltan hasta que suene la alarma
+void test_ticks_to_alarm(void) {
+    static const clock_time_t new_alarm = {.time = {.hours = {1, 2}, .minutes = {0, 3}, .seconds = {0, 0}}};
+    static const clock_time_t current_time = {.time = {.hours = {1, 2}, .minutes = {8, 2}, .seconds = {0, 0}}};
+    uint32_t ticks;
+
+    ClockSetTime(clock, &current_time);
+    ClockSetAlarm(clock, &new_alarm);
+    ticks = ClockTicksToChange(clock, CLOCK_CHANGED_ALARM);
+    TEST_ASSERT_EQUAL_UINT32(120 * CLOCK_TICK_PER_SECONDS, ticks);
+    ClockTakeChanges(clock);
+    for (uint32_t tick = 1; tick < ticks; tick++) {
+        ClockNewTick(clock);
+    }
+    TEST_ASSERT_FALSE(ClockIsAlarmActive(clock));
+    ClockNewTick(clock);
+    TEST_ASSERT_TRUE(ClockIsAlarmActive(clock));
+}
+
+// Sin alarma habilitada o con la alarma sonando no hay cambio previsto
+void test_no_alarm_change_expected(void) {
+    static const clock_time_t new_alarm = {.time = {.hours = {1, 2}, .minutes = {0, 3}, .seconds = {0, 0}}};
+    static const clock_time_t current_time = {.time = {.hours = {1, 2}, .minutes = {9, 2}, .seconds = {9, 5}}};
+
+    TEST_ASSERT_EQUAL_UINT32(CLOCK_NO_CHANGE, ClockTicksToChange(clock, CLOCK_CHANGED_ALARM));
+    ClockSetTime(clock, &current_time);
+    ClockSetAlarm(clock, &new_alarm);
+    ClockAlarmEnable(clock, false);
+    TEST_ASSERT_EQUAL_UINT32(CLOCK_NO_CHANGE, ClockTicksToChange(clock, CLOCK_CHANGED_ALARM));
+    ClockAlarmEnable(clock, true);
+    SimulateSeconds(clock, 1);
+    TEST_ASSERT_TRUE(ClockIsAlarmActive(clock));
+    TEST_ASSERT_EQUAL_UINT32(CLOCK_NO_CHANGE, ClockTicksToChange(clock, CLOCK_CHANGED_ALARM));
+}
+
+// La primera sincronización solamente toma la referencia del contador
+void test_first_sync_takes_reference(void) {
+    static const clock_time_t new_time = {.time = {.hours = {1, 2}, .minutes = {3, 0}, .seconds = {4, 0}}};
+    clock_time_t now;
+
+    ClockSetTime(clock, &new_time);
+    TEST_ASSERT_TRUE(ClockSync(clock, 123456));
+    ClockGetTime(clock, &now);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(new_time.bcd, now.bcd, sizeof(now.bcd));
+}
+
+// Sincronizar avanza los ticks transcurridos aunque el contador desborde
+void test_sync_advances_elapsed_ticks_across_wrap(void) {
+    static const clock_time_t new_time = {.time = {.hours = {1, 2}, .minutes = {3, 0}, .seconds = {4, 0}}};
+    static const clock_time_t expected = {.time = {.hours = {1, 2}, .minutes = {3, 0}, .seconds = {7, 0}}};
+    clock_time_t now;
+
+    ClockSetTime(clock, &new_time);
+    ClockSync(clock, UINT32_MAX - 6);
+    ClockSync(clock, UINT32_MAX - 4);
+    ClockSync(clock, 9);
+    ClockGetTime(clock, &now);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected.bcd, now.bcd, sizeof(now.bcd));
+    TEST_ASSERT_EQUAL_UINT32(CLOCK_TICK_PER_SECONDS - 1, ClockTicksToChange(clock, CLOCK_CHANGED_SECONDS));
+}
+
+// Con la tarea que sincroniza demorada al azar durante 25 horas el reloj no atrasa
+void test_sync_does_not_drift_when_starved(void) {
+    static const clock_time_t new_time = {.time = {.hours = {1, 2}, .minutes = {3, 0}, .seconds = {4, 0}}};
+    static const clock_time_t expected = {.time = {.hours = {2, 2}, .minutes = {3, 0}, .seconds = {4, 0}}};
+    const uint32_t total = 25 * 3600 * CLOCK_TICK_PER_SECONDS;
+    uint32_t random = 12345;
+    uint32_t counter = 0xFFFF0000;
+    uint32_t syncs = 0;
+    uint32_t delay;
+    clock_time_t now;
+
+    ClockSetTime(clock, &new_time);
+    ClockSync(clock, counter);
+    for (uint32_t tick = 0; tick < total;) {
+        // La tarea se demora entre 1 y 64 ticks, y a veces queda sin ejecutarse 10 minutos
+        random = random * 1103515245 + 12345;
+        delay = ((random >> 16) % 1000 == 0) ? 600 * CLOCK_TICK_PER_SECONDS : 1 + (random >> 16) % 64;
+        delay = (delay < total - tick) ? delay : total - tick;
+        counter += delay;
+        tick += delay;
+        ClockSync(clock, counter);
+        syncs++;
+    }
+    ClockGetTime(clock, &now);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected.bcd, now.bcd, sizeof(now.bcd));
+    // Contar una vez por sincronización hubiera perdido casi todo el tiempo
+    TEST_ASSERT_LESS_THAN_UINT32(total / 16, syncs);
+}
+
+// Una sincronización tardía no saltea la alarma
+void test_late_sync_does_not_skip_alarm(void) {
+    static const clock_time_t new_alarm = {.time = {.hours = {1, 2}, .minutes = {0, 3}, .seconds = {0, 0}}};
+    static const clock_time_t current_time = {.time = {.hours = {1, 2}, .minutes = {8, 2}, .seconds = {0, 0}}};
+
+    ClockSetTime(clock, &current_time);
+    ClockSetAlarm(clock, &new_alarm);
+    ClockSync(clock, 0);
+    ClockSync(clock, 300 * CLOCK_TICK_PER_SECONDS);
+    TEST_ASSERT_TRUE(ClockIsAlarmActive(clock));
+}
+
 // Test punteros nulos
 void test_null_pointers(void) {
     TEST_ASSERT_FALSE(ClockSetTime(NULL, NULL));
@@ -360,6 +576,9 @@ void test_null_pointers(void) {
     TEST_ASSERT_FALSE(ClockAlarmEnable(NULL, true));
     TEST_ASSERT_FALSE(ClockPostponeAlarm(NULL));
     TEST_ASSERT_FALSE(ClockNewTick(NULL));
+    TEST_ASSERT_EQUAL_UINT8(0, ClockTakeChanges(NULL));
+    TEST_ASSERT_EQUAL_UINT32(CLOCK_NO_CHANGE, ClockTicksToChange(NULL, CLOCK_CHANGED_SECONDS));
+    TEST_ASSERT_FALSE(ClockSync(NULL, 0));
 }
 
 /* === End of documentation ======================================================================================== */
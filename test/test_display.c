@@ -0,0 +1,443 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, María Ayelén Vega Caro <ayelenvegacaro@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+
+PRUEBAS A REALIZAR
+- Al refrescar se recorren los dígitos en orden: apagar, cargar segmentos y encender
+- Si se escriben menos dígitos que los de la pantalla el resto queda apagado
+- Se pueden escribir dígitos apagados y guiones, y los valores inválidos quedan apagados
+- Una pantalla de 8 dígitos recorre los 8 dígitos en cada barrido
+- Los dígitos que parpadean se apagan en la primera mitad del período
+- Los puntos que parpadean se encienden en la segunda mitad del período
+- Un punto fijo se muestra en todos los barridos
+- Un punto que parpadea ignora el punto fijo del mismo dígito, que vuelve a verse al quitar el efecto
+- Un dígito y un punto parpadean con períodos distintos
+- Dos dígitos con el mismo período y fases distintas parpadean alternados
+- Si no quedan efectos libres se informa el error
+- Parámetros inválidos en las funciones de parpadeo y puntos
+- Con paso de barrido mayor a uno los efectos avanzan varios barridos por vez
+- Apagar la pantalla apaga los dígitos
+- Una animación muestra cada cuadro durante su duración y avisa al terminar
+- Una marquesina desplaza un texto de a un dígito por cuadro
+- Una animación cíclica vuelve a empezar y se puede detener sin aviso
+- En una pantalla de 6 dígitos una animación de 4 dígitos apaga los dos que sobran
+- En una pantalla de 8 dígitos una marquesina de 4 dígitos no lee más allá de su texto
+- No se reproduce una animación sin dígitos
+- Al terminar la animación se vuelve a mostrar el valor escrito con sus efectos
+- Sin efectos ni animaciones lo que se ve no cambia solo
+- Se calculan los barridos hasta el próximo cambio de un parpadeo
+- Se calculan los barridos hasta el próximo cuadro de una animación
+
+*********************************************************************************************************************/
+
+/** @file  test_display.c
+ ** @brief Pruebas del display multiplexado comparando la traza del driver con trazas de referencia
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+#include "unity.h"
+#include "display.h"
+#include "display_recorder.h"
+
+/* === Macros definitions ========================================================================================== */
+#define DISPLAY_DIGITS 4 //!< Cantidad de dígitos de la pantalla
+
+#define SEGMENTS_0     (SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_E | SEGMENT_F)
+#define SEGMENTS_1     (SEGMENT_B | SEGMENT_C)
+#define SEGMENTS_2     (SEGMENT_A | SEGMENT_B | SEGMENT_D | SEGMENT_E | SEGMENT_G)
+#define SEGMENTS_3     (SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_G)
+#define SEGMENTS_4     (SEGMENT_B | SEGMENT_C | SEGMENT_F | SEGMENT_G)
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations ===============================================================================*/
+/**
+ * @brief Refresca la pantalla una cantidad dada de veces
+ *
+ * @param count Cantidad de refrescos
+ */
+static void SimulateRefresh(uint32_t count);
+
+/**
+ * @brief Función de finalización que cuenta cuántas veces terminó una animación
+ *
+ * @param display Display que terminó la animación
+ * @param context Contador de finalizaciones
+ */
+static void AnimationDone(display_t display, void * context);
+
+/* === Private variable definitions ================================================================================ */
+static display_t display;
+static uint8_t value[] = {1, 2, 3, 4};
+
+//! Dos cuadros independientes, el primero dura un barrido y el segundo dos
+static const uint8_t spinner_segments[] = {
+    SEGMENT_A, SEGMENT_A, SEGMENT_A, SEGMENT_A, SEGMENT_D, SEGMENT_D, SEGMENT_D, SEGMENT_D,
+};
+static const uint16_t spinner_durations[] = {1, 2};
+static const struct display_animation_s spinner = {
+    .segments = spinner_segments,
+    .durations = spinner_durations,
+    .frames = 2,
+    .width = DISPLAY_DIGITS,
+    .stride = DISPLAY_DIGITS,
+};
+
+//! Texto de cinco dígitos que se desplaza en dos cuadros de un barrido
+static const uint8_t marquee_segments[] = {SEGMENTS_0, SEGMENTS_1, SEGMENTS_2, SEGMENTS_3, SEGMENTS_4};
+static const struct display_animation_s marquee = {
+    .segments = marquee_segments,
+    .duration = 1,
+    .frames = 2,
+    .width = DISPLAY_DIGITS,
+    .stride = 1,
+    .loop = true,
+};
+
+static uint8_t animations_done;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+static void SimulateRefresh(uint32_t count) {
+    for (uint32_t i = 0; i < count; i++) {
+        DisplayRefresh(display);
+    }
+}
+
+static void AnimationDone(display_t display, void * context) {
+    (void)display;
+    (*(uint8_t *)context)++;
+}
+
+/* === Public function implementation ============================================================================== */
+void setUp(void) {
+    animations_done = 0;
+    display = DisplayCreate(DISPLAY_DIGITS, DisplayRecorderCreate());
+    DisplayWrite(display, value, sizeof(value));
+}
+
+// Al refrescar se recorren los dígitos en orden: apagar, cargar segmentos y encender
+void test_refresh_scans_digits_in_order(void) {
+    static const uint16_t expected[] = {
+        TRACE_STEP(1, SEGMENTS_2),
+        TRACE_STEP(2, SEGMENTS_3),
+        TRACE_STEP(3, SEGMENTS_4),
+        TRACE_STEP(0, SEGMENTS_1),
+    };
+    SimulateRefresh(4);
+    TEST_ASSERT_DISPLAY_TRACE(expected);
+}
+
+// Si se escriben menos dígitos que los de la pantalla el resto queda apagado
+void test_short_write_turns_off_remaining_digits(void) {
+    static const uint16_t expected[] = {
+        TRACE_STEP(1, SEGMENTS_0),
+        TRACE_STEP(2, 0),
+        TRACE_STEP(3, 0),
+        TRACE_STEP(0, SEGMENTS_4),
+    };
+    uint8_t short_value[] = {4, 0};
+
+    DisplayWrite(display, short_value, sizeof(short_value));
+    SimulateRefresh(4);
+    TEST_ASSERT_DISPLAY_TRACE(expected);
+}
+
+// Se pueden escribir dígitos apagados y guiones, y los valores inválidos quedan apagados
+void test_write_blank_and_dash(void) {
+    static const uint16_t expected[] = {
+        TRACE_STEP(1, SEGMENT_G),
+        TRACE_STEP(2, 0),
+        TRACE_STEP(3, SEGMENTS_4),
+        TRACE_STEP(0, 0),
+    };
+    uint8_t special_value[] = {DISPLAY_BLANK, DISPLAY_DASH, 0xFF, 4};
+
+    DisplayWrite(display, special_value, sizeof(special_value));
+    SimulateRefresh(4);
+    TEST_ASSERT_DISPLAY_TRACE(expected);
+}
+
+// Una pantalla de 8 dígitos recorre los 8 dígitos en cada barrido
+void test_eight_digit_display(void) {
+    static const uint16_t expected[] = {
+        TRACE_STEP(1, SEGMENTS_2), TRACE_STEP(2, SEGMENT_G), TRACE_STEP(3, SEGMENTS_3), TRACE_STEP(4, SEGMENTS_4),
+        TRACE_STEP(5, SEGMENT_G),  TRACE_STEP(6, SEGMENTS_0), TRACE_STEP(7, SEGMENTS_1), TRACE_STEP(0, SEGMENTS_1),
+    };
+    uint8_t time_value[] = {1, 2, DISPLAY_DASH, 3, 4, DISPLAY_DASH, 0, 1};
+
+    display = DisplayCreate(DISPLAY_MAX_DIGITS, DisplayRecorderCreate());
+    TEST_ASSERT_EQUAL_UINT8(DISPLAY_MAX_DIGITS, DisplayDigits(display));
+    DisplayWrite(display, time_value, sizeof(time_value));
+    SimulateRefresh(8);
+    TEST_ASSERT_DISPLAY_TRACE(expected);
+}
+
+// Los dígitos que parpadean se apagan en la primera mitad del período
+void test_flashing_digits_are_off_in_first_half(void) {
+    static const uint16_t expected[] = {
+        TRACE_STEP(1, 0),          TRACE_STEP(2, 0),          TRACE_STEP(3, SEGMENTS_4), TRACE_STEP(0, SEGMENTS_1),
+        TRACE_STEP(1, SEGMENTS_2), TRACE_STEP(2, SEGMENTS_3), TRACE_STEP(3, SEGMENTS_4), TRACE_STEP(0, SEGMENTS_1),
+    };
+    TEST_ASSERT_EQUAL_INT(0, DisplayFlashDigits(display, 1, 2, 1));
+    SimulateRefresh(8);
+    TEST_ASSERT_DISPLAY_TRACE(expected);
+}
+
+// Los puntos que parpadean se encienden en la segunda mitad del período
+void test_flashing_points_are_on_in_second_half(void) {
+    static const uint16_t expected[] = {
+        TRACE_STEP(1, SEGMENTS_2), TRACE_STEP(2, SEGMENTS_3), TRACE_STEP(3, SEGMENTS_4),
+        TRACE_STEP(0, SEGMENTS_1 | SEGMENT_P), TRACE_STEP(1, SEGMENTS_2), TRACE_STEP(2, SEGMENTS_3),
+        TRACE_STEP(3, SEGMENTS_4), TRACE_STEP(0, SEGMENTS_1),
+    };
+    TEST_ASSERT_EQUAL_INT(0, DisplayFlashPoint(display, 0x01, 1));
+    SimulateRefresh(8);
+    TEST_ASSERT_DISPLAY_TRACE(expected);
+}
+
+// Un punto fijo se muestra en todos los barridos
+void test_set_point_is_always_on(void) {
+    static const uint16_t expected[] = {
+        TRACE_STEP(1, SEGMENTS_2), TRACE_STEP(2, SEGMENTS_3 | SEGMENT_P), TRACE_STEP(3, SEGMENTS_4),
+        TRACE_STEP(0, SEGMENTS_1), TRACE_STEP(1, SEGMENTS_2), TRACE_STEP(2, SEGMENTS_3 | SEGMENT_P),
+    };
+    TEST_ASSERT_EQUAL_INT(0, DisplaySetPoint(display, 2, true));
+    SimulateRefresh(6);
+    TEST_ASSERT_DISPLAY_TRACE(expected);
+}
+
+// Un punto que parpadea ignora el punto fijo del mismo dígito, que vuelve a verse al quitar el efecto
+void test_flashing_point_overrides_set_point_until_removed(void) {
+    static const uint16_t expected[] = {
+        TRACE_STEP(1, SEGMENTS_2), TRACE_STEP(2, SEGMENTS_3), TRACE_STEP(3, SEGMENTS_4),
+        TRACE_STEP(0, SEGMENTS_1 | SEGMENT_P), TRACE_STEP(1, SEGMENTS_2), TRACE_STEP(2, SEGMENTS_3),
+        TRACE_STEP(3, SEGMENTS_4), TRACE_STEP(0, SEGMENTS_1), TRACE_STEP(1, SEGMENTS_2),
+        TRACE_STEP(2, SEGMENTS_3), TRACE_STEP(3, SEGMENTS_4), TRACE_STEP(0, SEGMENTS_1 | SEGMENT_P),
+    };
+    DisplaySetPoint(display, 0, true);
+    DisplayFlashPoint(display, 0x01, 1);
+    SimulateRefresh(8);
+    DisplayFlashPoint(display, 0x01, 0);
+    SimulateRefresh(4);
+    TEST_ASSERT_DISPLAY_TRACE(expected);
+}
+
+// Un dígito y un punto parpadean con períodos distintos
+void test_digit_and_point_flash_at_different_rates(void) {
+    static const uint16_t expected[] = {
+        TRACE_STEP(1, SEGMENTS_2), TRACE_STEP(2, SEGMENTS_3), TRACE_STEP(3, SEGMENTS_4), TRACE_STEP(0, SEGMENTS_1),
+        TRACE_STEP(1, SEGMENTS_2), TRACE_STEP(2, SEGMENTS_3), TRACE_STEP(3, SEGMENTS_4), TRACE_STEP(0, 0),
+        TRACE_STEP(1, SEGMENTS_2 | SEGMENT_P), TRACE_STEP(2, SEGMENTS_3), TRACE_STEP(3, SEGMENTS_4),
+        TRACE_STEP(0, SEGMENTS_1), TRACE_STEP(1, SEGMENTS_2 | SEGMENT_P),
+    };
+    TEST_ASSERT_EQUAL_INT(0, DisplaySetDigitEffect(display, 0, 2, 0));
+    TEST_ASSERT_EQUAL_INT(0, DisplaySetPointEffect(display, 1, 4, 0));
+    DisplayRecorderClear();
+    SimulateRefresh(13);
+    TEST_ASSERT_DISPLAY_TRACE(expected);
+}
+
+// Dos dígitos con el mismo período y fases distintas parpadean alternados
+void test_phase_offset_alternates_digits(void) {
+    static const uint16_t expected[] = {
+        TRACE_STEP(1, SEGMENTS_2), TRACE_STEP(2, 0),          TRACE_STEP(3, SEGMENTS_4), TRACE_STEP(0, SEGMENTS_1),
+        TRACE_STEP(1, SEGMENTS_2), TRACE_STEP(2, SEGMENTS_3), TRACE_STEP(3, 0),          TRACE_STEP(0, SEGMENTS_1),
+    };
+    TEST_ASSERT_EQUAL_INT(0, DisplaySetDigitEffect(display, 2, 2, 0));
+    TEST_ASSERT_EQUAL_INT(0, DisplaySetDigitEffect(display, 3, 2, 1));
+    SimulateRefresh(8);
+    TEST_ASSERT_DISPLAY_TRACE(expected);
+}
+
+// Si no quedan efectos libres se informa el error
+void test_no_free_effects(void) {
+    for (uint8_t digit = 0; digit < DISPLAY_DIGITS; digit++) {
+        TEST_ASSERT_EQUAL_INT(0, DisplaySetDigitEffect(display, digit, 10 + digit, 0));
+    }
+    TEST_ASSERT_EQUAL_INT(-1, DisplaySetPointEffect(display, 0, 20, 0));
+    TEST_ASSERT_EQUAL_INT(0, DisplaySetPointEffect(display, 0, 10, 0));
+    TEST_ASSERT_EQUAL_INT(0, DisplaySetDigitEffect(display, 3, 0, 0));
+    TEST_ASSERT_EQUAL_INT(0, DisplaySetPointEffect(display, 1, 20, 0));
+}
+
+// Parámetros inválidos en las funciones de parpadeo y puntos
+void test_invalid_parameters(void) {
+    TEST_ASSERT_EQUAL_INT(-1, DisplayFlashDigits(display, 2, 1, 1));
+    TEST_ASSERT_EQUAL_INT(-1, DisplayFlashDigits(display, 0, DISPLAY_MAX_DIGITS, 1));
+    TEST_ASSERT_EQUAL_INT(-1, DisplayFlashDigits(NULL, 0, 1, 1));
+    TEST_ASSERT_EQUAL_INT(-1, DisplayFlashPoint(NULL, 0x01, 1));
+    TEST_ASSERT_EQUAL_INT(-1, DisplaySetPoint(NULL, 0, true));
+    TEST_ASSERT_EQUAL_INT(-1, DisplaySetPoint(display, DISPLAY_DIGITS, true));
+    TEST_ASSERT_EQUAL_INT(-1, DisplaySetDigitEffect(display, DISPLAY_DIGITS, 2, 0));
+    TEST_ASSERT_EQUAL_INT(-1, DisplaySetDigitEffect(display, 0, 2, 2));
+    TEST_ASSERT_EQUAL_INT(-1, DisplaySetPointEffect(NULL, 0, 2, 0));
+    TEST_ASSERT_EQUAL_INT(-1, DisplaySetSweepStep(display, 0));
+    TEST_ASSERT_EQUAL_INT(-1, DisplaySetSweepStep(NULL, 1));
+    TEST_ASSERT_EQUAL_INT(-1, DisplayPlay(display, NULL, NULL, NULL));
+    TEST_ASSERT_EQUAL_INT(-1, DisplayPlay(NULL, &spinner, NULL, NULL));
+}
+
+// Con paso de barrido mayor a uno los efectos avanzan varios barridos por vez
+void test_sweep_step_advances_effects_faster(void) {
+    static const uint16_t expected[] = {
+        TRACE_STEP(1, 0),          TRACE_STEP(2, SEGMENTS_3), TRACE_STEP(3, SEGMENTS_4), TRACE_STEP(0, SEGMENTS_1),
+        TRACE_STEP(1, SEGMENTS_2), TRACE_STEP(2, SEGMENTS_3), TRACE_STEP(3, SEGMENTS_4), TRACE_STEP(0, SEGMENTS_1),
+    };
+    TEST_ASSERT_EQUAL_INT(0, DisplayFlashDigits(display, 1, 1, 2));
+    TEST_ASSERT_EQUAL_INT(0, DisplaySetSweepStep(display, 2));
+    SimulateRefresh(8);
+    TEST_ASSERT_DISPLAY_TRACE(expected);
+}
+
+// Apagar la pantalla apaga los dígitos
+void test_turn_off_display(void) {
+    static const uint16_t expected[] = {
+        TRACE_OFF(),
+    };
+    DisplayTurnOff(display);
+    TEST_ASSERT_DISPLAY_TRACE(expected);
+}
+
+// Una animación muestra cada cuadro durante su duración y avisa al terminar
+void test_animation_plays_frames_and_signals_done(void) {
+    static const uint16_t expected[] = {
+        TRACE_STEP(1, SEGMENT_A), TRACE_STEP(2, SEGMENT_A), TRACE_STEP(3, SEGMENT_A), TRACE_STEP(0, SEGMENT_D),
+        TRACE_STEP(1, SEGMENT_D), TRACE_STEP(2, SEGMENT_D), TRACE_STEP(3, SEGMENT_D), TRACE_STEP(0, SEGMENT_D),
+        TRACE_STEP(1, SEGMENT_D), TRACE_STEP(2, SEGMENT_D), TRACE_STEP(3, SEGMENT_D), TRACE_STEP(0, SEGMENTS_1),
+    };
+    TEST_ASSERT_EQUAL_INT(0, DisplayPlay(display, &spinner, AnimationDone, &animations_done));
+    TEST_ASSERT_TRUE(DisplayIsPlaying(display));
+    SimulateRefresh(11);
+    TEST_ASSERT_EQUAL_UINT8(0, animations_done);
+    SimulateRefresh(1);
+    TEST_ASSERT_EQUAL_UINT8(1, animations_done);
+    TEST_ASSERT_FALSE(DisplayIsPlaying(display));
+    TEST_ASSERT_DISPLAY_TRACE(expected);
+}
+
+// Una marquesina desplaza un texto de a un dígito por cuadro
+void test_marquee_scrolls_text(void) {
+    static const uint16_t expected[] = {
+        TRACE_STEP(1, SEGMENTS_1), TRACE_STEP(2, SEGMENTS_2), TRACE_STEP(3, SEGMENTS_3), TRACE_STEP(0, SEGMENTS_1),
+        TRACE_STEP(1, SEGMENTS_2), TRACE_STEP(2, SEGMENTS_3), TRACE_STEP(3, SEGMENTS_4), TRACE_STEP(0, SEGMENTS_0),
+    };
+    TEST_ASSERT_EQUAL_INT(0, DisplayPlay(display, &marquee, NULL, NULL));
+    SimulateRefresh(8);
+    TEST_ASSERT_DISPLAY_TRACE(expected);
+}
+
+// Una animación cíclica vuelve a empezar y se puede detener sin aviso
+void test_looping_animation_restarts_until_stopped(void) {
+    TEST_ASSERT_EQUAL_INT(0, DisplayPlay(display, &marquee, AnimationDone, &animations_done));
+    SimulateRefresh(20);
+    TEST_ASSERT_TRUE(DisplayIsPlaying(display));
+    DisplayStop(display);
+    TEST_ASSERT_FALSE(DisplayIsPlaying(display));
+    TEST_ASSERT_EQUAL_UINT8(0, animations_done);
+}
+
+// En una pantalla de 6 dígitos una animación de 4 dígitos apaga los dos que sobran
+void test_animation_narrower_than_six_digits(void) {
+    static const uint16_t expected[] = {
+        TRACE_STEP(1, SEGMENT_A), TRACE_STEP(2, SEGMENT_A), TRACE_STEP(3, SEGMENT_A),
+        TRACE_STEP(4, 0),         TRACE_STEP(5, 0),         TRACE_STEP(0, SEGMENT_D),
+    };
+    uint8_t time_value[] = {1, 2, 3, 4, 0, 1};
+
+    display = DisplayCreate(6, DisplayRecorderCreate());
+    DisplayWrite(display, time_value, sizeof(time_value));
+    TEST_ASSERT_EQUAL_INT(0, DisplayPlay(display, &spinner, NULL, NULL));
+    SimulateRefresh(6);
+    TEST_ASSERT_DISPLAY_TRACE(expected);
+}
+
+// En una pantalla de 8 dígitos una marquesina de 4 dígitos no lee más allá de su texto
+void test_marquee_narrower_than_eight_digits(void) {
+    static const uint16_t expected[] = {
+        TRACE_STEP(1, SEGMENTS_1), TRACE_STEP(2, SEGMENTS_2), TRACE_STEP(3, SEGMENTS_3), TRACE_STEP(4, 0),
+        TRACE_STEP(5, 0),          TRACE_STEP(6, 0),          TRACE_STEP(7, 0),          TRACE_STEP(0, SEGMENTS_1),
+        TRACE_STEP(1, SEGMENTS_2), TRACE_STEP(2, SEGMENTS_3), TRACE_STEP(3, SEGMENTS_4), TRACE_STEP(4, 0),
+        TRACE_STEP(5, 0),          TRACE_STEP(6, 0),          TRACE_STEP(7, 0),          TRACE_STEP(0, SEGMENTS_0),
+    };
+
+    display = DisplayCreate(DISPLAY_MAX_DIGITS, DisplayRecorderCreate());
+    TEST_ASSERT_EQUAL_INT(0, DisplayPlay(display, &marquee, NULL, NULL));
+    SimulateRefresh(16);
+    TEST_ASSERT_DISPLAY_TRACE(expected);
+}
+
+// No se reproduce una animación sin dígitos
+void test_animation_without_width(void) {
+    static const struct display_animation_s empty = {
+        .segments = spinner_segments,
+        .duration = 1,
+        .frames = 2,
+        .stride = DISPLAY_DIGITS,
+    };
+
+    TEST_ASSERT_EQUAL_INT(-1, DisplayPlay(display, &empty, NULL, NULL));
+    TEST_ASSERT_FALSE(DisplayIsPlaying(display));
+}
+
+// Al terminar la animación se vuelve a mostrar el valor escrito con sus efectos
+void test_effects_resume_after_animation(void) {
+    static const uint16_t expected[] = {
+        TRACE_STEP(1, SEGMENTS_2), TRACE_STEP(2, SEGMENTS_3), TRACE_STEP(3, SEGMENTS_4),
+        TRACE_STEP(0, SEGMENTS_1 | SEGMENT_P),
+    };
+    DisplaySetPoint(display, 0, true);
+    DisplayPlay(display, &spinner, NULL, NULL);
+    SimulateRefresh(12);
+    DisplayRecorderClear();
+    SimulateRefresh(4);
+    TEST_ASSERT_DISPLAY_TRACE(expected);
+}
+
+// Sin efectos ni animaciones lo que se ve no cambia solo
+void test_no_change_without_effects(void) {
+    DisplaySetPoint(display, 0, true);
+    TEST_ASSERT_EQUAL_UINT16(DISPLAY_NO_CHANGE, DisplaySweepsToChange(display));
+    TEST_ASSERT_EQUAL_UINT16(DISPLAY_NO_CHANGE, DisplaySweepsToChange(NULL));
+}
+
+// Se calculan los barridos hasta el próximo cambio de un parpadeo
+void test_sweeps_to_next_flash_change(void) {
+    DisplayFlashDigits(display, 0, 1, 5);
+    DisplaySetPointEffect(display, 3, 6, 0);
+    TEST_ASSERT_EQUAL_UINT16(3, DisplaySweepsToChange(display));
+    SimulateRefresh(3 * DISPLAY_DIGITS);
+    TEST_ASSERT_EQUAL_UINT16(2, DisplaySweepsToChange(display));
+    SimulateRefresh(2 * DISPLAY_DIGITS);
+    TEST_ASSERT_EQUAL_UINT16(1, DisplaySweepsToChange(display));
+    SimulateRefresh(DISPLAY_DIGITS);
+    TEST_ASSERT_EQUAL_UINT16(3, DisplaySweepsToChange(display));
+}
+
+// Se calculan los barridos hasta el próximo cuadro de una animación
+void test_sweeps_to_next_animation_frame(void) {
+    DisplayFlashDigits(display, 0, 1, 5);
+    DisplayPlay(display, &spinner, NULL, NULL);
+    TEST_ASSERT_EQUAL_UINT16(1, DisplaySweepsToChange(display));
+    SimulateRefresh(DISPLAY_DIGITS);
+    TEST_ASSERT_EQUAL_UINT16(2, DisplaySweepsToChange(display));
+    SimulateRefresh(DISPLAY_DIGITS);
+    TEST_ASSERT_EQUAL_UINT16(1, DisplaySweepsToChange(display));
+}
+
+/* === End of documentation ======================================================================================== */
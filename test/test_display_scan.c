@@ -0,0 +1,206 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, María Ayelén Vega Caro <ayelenvegacaro@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+
+PRUEBAS A REALIZAR
+- Con brillo máximo el período es el más largo que mantiene la frecuencia sin parpadeo
+- Cambiar el brillo recalcula el período y rechaza niveles inválidos
+- Sin actividad pasa a frecuencia reducida y después apaga la pantalla
+- En frecuencia reducida los efectos avanzan varios barridos por despertar
+- La actividad vuelve a la frecuencia completa
+- Se cuentan los despertares por segundo en cada estado
+- Los tiempos se convierten a barridos a frecuencia completa
+- Con tiempos de inactividad en cero nunca baja la frecuencia
+- Con 6 y 8 dígitos el período se acorta para mantener la frecuencia de cada dígito
+- Los barridos se convierten a tiempo
+- Se calcula el tiempo hasta el próximo cambio de estado por inactividad
+
+*********************************************************************************************************************/
+
+/** @file  test_display_scan.c
+ ** @brief Pruebas del planificador de barrido de la pantalla
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+#include "unity.h"
+#include "display_scan.h"
+
+/* === Macros definitions ========================================================================================== */
+#define DISPLAY_DIGITS 4 //!< Cantidad de dígitos de la pantalla
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations ===============================================================================*/
+/**
+ * @brief Simula los despertares de la tarea de refresco durante un tiempo dado
+ *
+ * @param ms Tiempo a simular en milisegundos
+ */
+static void SimulateTime(uint32_t ms);
+
+/* === Private variable definitions ================================================================================ */
+static const struct display_scan_config_s config = {
+    .flicker_free_hz = {60, 70, 80, 100},
+    .idle_divider = 2,
+    .idle_timeout_ms = 10000,
+    .blank_timeout_ms = 20000,
+    .blank_period_ms = 500,
+};
+
+static display_scan_t scan;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+static void SimulateTime(uint32_t ms) {
+    uint32_t elapsed = 0;
+    while (elapsed < ms) {
+        uint16_t period = DisplayScanPeriod(scan);
+        DisplayScanElapsed(scan, period);
+        elapsed += period;
+    }
+}
+
+/* === Public function implementation ============================================================================== */
+void setUp(void) {
+    scan = DisplayScanCreate(&config, DISPLAY_DIGITS, 3);
+}
+
+// Con brillo máximo el período es el más largo que mantiene la frecuencia sin parpadeo
+void test_active_period_keeps_flicker_free_rate(void) {
+    TEST_ASSERT_NOT_NULL(scan);
+    TEST_ASSERT_EQUAL(DISPLAY_SCAN_ACTIVE, DisplayScanState(scan));
+    // 100 barridos por segundo de 4 dígitos son 400 pasos, cada 2,5 ms, redondeado a 2 ms
+    TEST_ASSERT_EQUAL_UINT16(2, DisplayScanPeriod(scan));
+    TEST_ASSERT_EQUAL_UINT8(1, DisplayScanSweepStep(scan));
+}
+
+// Cambiar el brillo recalcula el período y rechaza niveles inválidos
+void test_brightness_changes_period(void) {
+    TEST_ASSERT_EQUAL_INT(0, DisplayScanSetBrightness(scan, 0));
+    TEST_ASSERT_EQUAL_UINT16(4, DisplayScanPeriod(scan));
+    TEST_ASSERT_EQUAL_INT(-1, DisplayScanSetBrightness(scan, DISPLAY_SCAN_BRIGHTNESS_LEVELS));
+    TEST_ASSERT_EQUAL_UINT16(4, DisplayScanPeriod(scan));
+    TEST_ASSERT_NULL(DisplayScanCreate(&config, DISPLAY_DIGITS, DISPLAY_SCAN_BRIGHTNESS_LEVELS));
+}
+
+// Sin actividad pasa a frecuencia reducida y después apaga la pantalla
+void test_inactivity_reduces_rate_then_blanks(void) {
+    SimulateTime(config.idle_timeout_ms);
+    TEST_ASSERT_EQUAL(DISPLAY_SCAN_IDLE, DisplayScanState(scan));
+    TEST_ASSERT_EQUAL_UINT16(4, DisplayScanPeriod(scan));
+
+    SimulateTime(config.blank_timeout_ms - config.idle_timeout_ms);
+    TEST_ASSERT_EQUAL(DISPLAY_SCAN_BLANK, DisplayScanState(scan));
+    TEST_ASSERT_EQUAL_UINT16(config.blank_period_ms, DisplayScanPeriod(scan));
+}
+
+// En frecuencia reducida los efectos avanzan varios barridos por despertar
+void test_idle_sweep_step(void) {
+    SimulateTime(config.idle_timeout_ms);
+    TEST_ASSERT_EQUAL_UINT8(config.idle_divider, DisplayScanSweepStep(scan));
+    SimulateTime(config.blank_timeout_ms - config.idle_timeout_ms);
+    TEST_ASSERT_EQUAL_UINT8(1, DisplayScanSweepStep(scan));
+}
+
+// La actividad vuelve a la frecuencia completa
+void test_activity_restores_full_rate(void) {
+    SimulateTime(config.blank_timeout_ms);
+    DisplayScanActivity(scan);
+    TEST_ASSERT_EQUAL(DISPLAY_SCAN_ACTIVE, DisplayScanState(scan));
+    TEST_ASSERT_EQUAL_UINT16(2, DisplayScanPeriod(scan));
+    SimulateTime(config.idle_timeout_ms - 2 * DisplayScanPeriod(scan));
+    TEST_ASSERT_EQUAL(DISPLAY_SCAN_ACTIVE, DisplayScanState(scan));
+}
+
+// Se cuentan los despertares por segundo en cada estado
+void test_wakeups_per_second(void) {
+    SimulateTime(1000);
+    TEST_ASSERT_EQUAL_UINT16(500, DisplayScanWakeupsPerSecond(scan));
+    SimulateTime(config.idle_timeout_ms + 1000);
+    TEST_ASSERT_EQUAL_UINT16(250, DisplayScanWakeupsPerSecond(scan));
+    SimulateTime(config.blank_timeout_ms);
+    TEST_ASSERT_EQUAL_UINT16(2, DisplayScanWakeupsPerSecond(scan));
+}
+
+// Los tiempos se convierten a barridos a frecuencia completa
+void test_ms_to_sweeps(void) {
+    TEST_ASSERT_EQUAL_UINT16(125, DisplayScanMsToSweeps(scan, 1000));
+    TEST_ASSERT_EQUAL_UINT16(1, DisplayScanMsToSweeps(scan, 1));
+    DisplayScanSetBrightness(scan, 0);
+    TEST_ASSERT_EQUAL_UINT16(62, DisplayScanMsToSweeps(scan, 1000));
+}
+
+// Con tiempos de inactividad en cero nunca baja la frecuencia
+void test_disabled_timeouts_keep_full_rate(void) {
+    static const struct display_scan_config_s always_on = {
+        .flicker_free_hz = {60, 70, 80, 100},
+        .idle_divider = 2,
+    };
+
+    scan = DisplayScanCreate(&always_on, DISPLAY_DIGITS, 3);
+    SimulateTime(60000);
+    TEST_ASSERT_EQUAL(DISPLAY_SCAN_ACTIVE, DisplayScanState(scan));
+    TEST_ASSERT_EQUAL_UINT16(2, DisplayScanPeriod(scan));
+}
+
+// Con 6 y 8 dígitos el período se acorta para mantener la frecuencia de cada dígito
+void test_more_digits_keep_refresh_rate(void) {
+    TEST_ASSERT_EQUAL_UINT16(125, DisplayScanRefreshRate(scan));
+
+    scan = DisplayScanCreate(&config, 6, 3);
+    TEST_ASSERT_EQUAL_UINT16(1, DisplayScanPeriod(scan));
+    TEST_ASSERT_EQUAL_UINT16(166, DisplayScanRefreshRate(scan));
+    TEST_ASSERT_EQUAL_UINT16(166, DisplayScanMsToSweeps(scan, 1000));
+
+    scan = DisplayScanCreate(&config, 8, 0);
+    TEST_ASSERT_EQUAL_UINT16(2, DisplayScanPeriod(scan));
+    TEST_ASSERT_EQUAL_UINT16(62, DisplayScanRefreshRate(scan));
+    TEST_ASSERT_EQUAL_INT(0, DisplayScanSetBrightness(scan, 3));
+    TEST_ASSERT_EQUAL_UINT16(1, DisplayScanPeriod(scan));
+    TEST_ASSERT_EQUAL_UINT16(125, DisplayScanRefreshRate(scan));
+}
+
+// Los barridos se convierten a tiempo
+void test_sweeps_to_ms(void) {
+    TEST_ASSERT_EQUAL_UINT32(1000, DisplayScanSweepsToMs(scan, 125));
+    TEST_ASSERT_EQUAL_UINT32(8, DisplayScanSweepsToMs(scan, 1));
+    TEST_ASSERT_EQUAL_UINT32(0, DisplayScanSweepsToMs(scan, 0));
+}
+
+// Se calcula el tiempo hasta el próximo cambio de estado por inactividad
+void test_ms_to_next_state(void) {
+    static const struct display_scan_config_s always_on = {
+        .flicker_free_hz = {60, 70, 80, 100},
+        .idle_divider = 2,
+    };
+
+    TEST_ASSERT_EQUAL_UINT32(config.idle_timeout_ms, DisplayScanMsToNextState(scan));
+    DisplayScanElapsed(scan, 4000);
+    TEST_ASSERT_EQUAL_UINT32(config.idle_timeout_ms - 4000, DisplayScanMsToNextState(scan));
+    DisplayScanElapsed(scan, config.idle_timeout_ms);
+    TEST_ASSERT_EQUAL_UINT32(config.blank_timeout_ms - config.idle_timeout_ms - 4000, DisplayScanMsToNextState(scan));
+    DisplayScanElapsed(scan, config.blank_timeout_ms);
+    TEST_ASSERT_EQUAL_UINT32(DISPLAY_SCAN_NO_DEADLINE, DisplayScanMsToNextState(scan));
+    DisplayScanActivity(scan);
+    TEST_ASSERT_EQUAL_UINT32(config.idle_timeout_ms, DisplayScanMsToNextState(scan));
+
+    scan = DisplayScanCreate(&always_on, DISPLAY_DIGITS, 3);
+    TEST_ASSERT_EQUAL_UINT32(DISPLAY_SCAN_NO_DEADLINE, DisplayScanMsToNextState(scan));
+}
+
+/* === End of documentation ======================================================================================== */
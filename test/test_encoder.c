@@ -0,0 +1,242 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, María Ayelén Vega Caro <ayelenvegacaro@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+
+PRUEBAS A REALIZAR
+- Cuatro transiciones en sentido horario son un paso hacia arriba
+- Cuatro transiciones en sentido antihorario son un paso hacia abajo
+- Un paso incompleto no se cuenta hasta completarlo
+- Los rebotes entre dos estados vecinos no generan pasos
+- Una transición en la que cambian los dos canales se cuenta como error y descarta el paso en curso
+- Cada lectura devuelve los pasos desde la lectura anterior
+- Girar rápido multiplica los pasos según la velocidad
+- Al cambiar de sentido el primer paso no se multiplica
+- Cada paso completo despierta a la tarea
+- Girando dentro de la capacidad de la interrupción no se pierde ningún paso
+- Girando más rápido que la interrupción se pierden pasos y se cuentan los errores
+- La cantidad de pasos perdidos crece con la velocidad
+- Parámetros inválidos
+
+*********************************************************************************************************************/
+
+/** @file  test_encoder.c
+ ** @brief Pruebas de la decodificación del encoder rotativo con un simulador de sus señales
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+#include "unity.h"
+#include "encoder.h"
+#include "encoder_sim.h"
+
+/* === Macros definitions ========================================================================================== */
+#define TRANSITIONS 4  //!< Transiciones de cada paso
+#define LATENCY_US  5  //!< Tiempo hasta que la interrupción simulada lee los pines
+#define SERVICE_US  10 //!< Duración de la interrupción simulada
+#define SLOW_US     ENCODER_SIM_EDGE_US(2, TRANSITIONS)   //!< Dos pasos por segundo
+#define MEDIUM_US   ENCODER_SIM_EDGE_US(20, TRANSITIONS)  //!< Veinte pasos por segundo
+#define FAST_US     ENCODER_SIM_EDGE_US(100, TRANSITIONS) //!< Cien pasos por segundo
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations ===============================================================================*/
+/**
+ * @brief Simula el aviso a la tarea contando las notificaciones
+ *
+ * @param context No se usa
+ */
+static void Notify(void * context);
+
+/**
+ * @brief Mide los pasos que se pierden girando a una velocidad, sin multiplicar por la velocidad
+ *
+ * @param steps Pasos a girar
+ * @param edge_us Tiempo entre flancos
+ * @return int32_t Pasos que no llegaron a la tarea
+ */
+static int32_t Missed(int32_t steps, uint32_t edge_us);
+
+/* === Private variable definitions ================================================================================ */
+static const struct encoder_config_s config = {
+    .transitions = TRANSITIONS,
+    .medium_ms = 100,
+    .fast_ms = 30,
+    .medium_scale = 2,
+    .fast_scale = 5,
+};
+
+//! Sin multiplicar por la velocidad, para medir pasos perdidos
+static const struct encoder_config_s unscaled = {
+    .transitions = TRANSITIONS,
+    .medium_scale = 1,
+    .fast_scale = 1,
+};
+
+static encoder_t encoder;
+static uint32_t notifications;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+static void Notify(void * context) {
+    (void)context;
+    notifications++;
+}
+
+static int32_t Missed(int32_t steps, uint32_t edge_us) {
+    EncoderStart(encoder, &unscaled, Notify, NULL);
+    EncoderSimTurn(steps * TRANSITIONS, edge_us);
+    return steps - EncoderTake(encoder);
+}
+
+/* === Public function implementation ============================================================================== */
+void setUp(void) {
+    encoder = EncoderCreate(0);
+    EncoderSimCreate(encoder, LATENCY_US, SERVICE_US);
+    EncoderStart(encoder, &config, Notify, NULL);
+    notifications = 0;
+    EncoderSimIdle(1000);
+}
+
+// Cuatro transiciones en sentido horario son un paso hacia arriba
+void test_clockwise_step(void) {
+    EncoderSimTurn(TRANSITIONS, SLOW_US);
+    TEST_ASSERT_EQUAL_INT32(1, EncoderTake(encoder));
+}
+
+// Cuatro transiciones en sentido antihorario son un paso hacia abajo
+void test_counterclockwise_step(void) {
+    EncoderSimTurn(-TRANSITIONS, SLOW_US);
+    TEST_ASSERT_EQUAL_INT32(-1, EncoderTake(encoder));
+}
+
+// Un paso incompleto no se cuenta hasta completarlo
+void test_partial_step(void) {
+    EncoderSimTurn(TRANSITIONS - 1, SLOW_US);
+    TEST_ASSERT_EQUAL_INT32(0, EncoderTake(encoder));
+    EncoderSimTurn(1, SLOW_US);
+    TEST_ASSERT_EQUAL_INT32(1, EncoderTake(encoder));
+}
+
+// Los rebotes entre dos estados vecinos no generan pasos
+void test_bounces_cancel(void) {
+    EncoderEdgeFromIsr(encoder, ENCODER_CHANNEL_A, 1000);
+    EncoderEdgeFromIsr(encoder, 0, 1000);
+    EncoderEdgeFromIsr(encoder, ENCODER_CHANNEL_A, 1000);
+    EncoderEdgeFromIsr(encoder, 0, 1001);
+    EncoderEdgeFromIsr(encoder, ENCODER_CHANNEL_A, 1001);
+    EncoderEdgeFromIsr(encoder, ENCODER_CHANNEL_A | ENCODER_CHANNEL_B, 1100);
+    EncoderEdgeFromIsr(encoder, ENCODER_CHANNEL_A, 1100);
+    EncoderEdgeFromIsr(encoder, ENCODER_CHANNEL_A | ENCODER_CHANNEL_B, 1101);
+    TEST_ASSERT_EQUAL_INT32(0, EncoderTake(encoder));
+    EncoderEdgeFromIsr(encoder, ENCODER_CHANNEL_B, 1200);
+    EncoderEdgeFromIsr(encoder, 0, 1300);
+    TEST_ASSERT_EQUAL_INT32(1, EncoderTake(encoder));
+    TEST_ASSERT_EQUAL_UINT16(0, EncoderErrors(encoder));
+}
+
+// Una transición en la que cambian los dos canales se cuenta como error y descarta el paso en curso
+void test_invalid_transition(void) {
+    EncoderEdgeFromIsr(encoder, ENCODER_CHANNEL_A, 1000);
+    EncoderEdgeFromIsr(encoder, ENCODER_CHANNEL_B, 1100);
+    TEST_ASSERT_EQUAL_UINT16(1, EncoderErrors(encoder));
+    EncoderEdgeFromIsr(encoder, 0, 1200);
+    TEST_ASSERT_EQUAL_INT32(0, EncoderTake(encoder));
+}
+
+// Cada lectura devuelve los pasos desde la lectura anterior
+void test_take_clears(void) {
+    EncoderSimTurn(3 * TRANSITIONS, SLOW_US);
+    TEST_ASSERT_EQUAL_INT32(3, EncoderTake(encoder));
+    TEST_ASSERT_EQUAL_INT32(0, EncoderTake(encoder));
+    EncoderSimTurn(-TRANSITIONS, SLOW_US);
+    TEST_ASSERT_EQUAL_INT32(-1, EncoderTake(encoder));
+}
+
+// Girar rápido multiplica los pasos según la velocidad
+void test_velocity_scaling(void) {
+    EncoderSimTurn(10 * TRANSITIONS, SLOW_US);
+    TEST_ASSERT_EQUAL_INT32(10, EncoderTake(encoder));
+    EncoderSimTurn(10 * TRANSITIONS, MEDIUM_US);
+    TEST_ASSERT_EQUAL_INT32(10 * 2, EncoderTake(encoder));
+    EncoderSimTurn(10 * TRANSITIONS, FAST_US);
+    TEST_ASSERT_EQUAL_INT32(10 * 5, EncoderTake(encoder));
+    EncoderSimIdle(1000);
+    EncoderSimTurn(TRANSITIONS, FAST_US);
+    TEST_ASSERT_EQUAL_INT32(1, EncoderTake(encoder));
+}
+
+// Al cambiar de sentido el primer paso no se multiplica
+void test_direction_change_restarts_scaling(void) {
+    EncoderSimTurn(2 * TRANSITIONS, FAST_US);
+    TEST_ASSERT_EQUAL_INT32(1 + 5, EncoderTake(encoder));
+    EncoderSimTurn(-2 * TRANSITIONS, FAST_US);
+    TEST_ASSERT_EQUAL_INT32(-(1 + 5), EncoderTake(encoder));
+}
+
+// Cada paso completo despierta a la tarea
+void test_notifications(void) {
+    EncoderSimTurn(3 * TRANSITIONS + 2, FAST_US);
+    TEST_ASSERT_EQUAL_UINT32(3, notifications);
+}
+
+// Girando dentro de la capacidad de la interrupción no se pierde ningún paso
+void test_no_missed_steps_within_isr_capacity(void) {
+    TEST_ASSERT_EQUAL_INT32(0, Missed(1000, ENCODER_SIM_EDGE_US(2000, TRANSITIONS)));
+    TEST_ASSERT_EQUAL_INT32(0, Missed(-1000, SERVICE_US));
+    TEST_ASSERT_EQUAL_UINT16(0, EncoderErrors(encoder));
+}
+
+// Girando más rápido que la interrupción se pierden pasos y se cuentan los errores
+void test_missed_steps_beyond_isr_capacity(void) {
+    uint32_t calls;
+
+    EncoderStart(encoder, &unscaled, Notify, NULL);
+    calls = EncoderSimTurn(100 * TRANSITIONS, LATENCY_US - 1);
+    TEST_ASSERT_LESS_THAN_UINT32(100 * TRANSITIONS, calls);
+    TEST_ASSERT_LESS_THAN_INT32(100, EncoderTake(encoder));
+    TEST_ASSERT_GREATER_THAN_UINT16(0, EncoderErrors(encoder));
+}
+
+// La cantidad de pasos perdidos crece con la velocidad
+void test_missed_steps_grow_with_speed(void) {
+    int32_t slower = Missed(100, SERVICE_US - 1);
+    int32_t faster;
+
+    EncoderSimIdle(1000);
+    faster = Missed(100, SERVICE_US - 3);
+    TEST_ASSERT_GREATER_THAN_INT32(0, slower);
+    TEST_ASSERT_GREATER_THAN_INT32(slower, faster);
+    TEST_ASSERT_LESS_OR_EQUAL_INT32(100, faster);
+}
+
+// Parámetros inválidos
+void test_invalid_parameters(void) {
+    static const struct encoder_config_s no_transitions = {.medium_scale = 1, .fast_scale = 1};
+    static const struct encoder_config_s three_transitions = {.transitions = 3, .medium_scale = 1, .fast_scale = 1};
+    static const struct encoder_config_s no_scale = {.transitions = TRANSITIONS, .fast_scale = 1};
+
+    TEST_ASSERT_EQUAL_INT(-1, EncoderStart(NULL, &config, Notify, NULL));
+    TEST_ASSERT_EQUAL_INT(-1, EncoderStart(encoder, NULL, Notify, NULL));
+    TEST_ASSERT_EQUAL_INT(-1, EncoderStart(encoder, &no_transitions, Notify, NULL));
+    TEST_ASSERT_EQUAL_INT(-1, EncoderStart(encoder, &three_transitions, Notify, NULL));
+    TEST_ASSERT_EQUAL_INT(-1, EncoderStart(encoder, &no_scale, Notify, NULL));
+    TEST_ASSERT_EQUAL_INT32(0, EncoderTake(NULL));
+    TEST_ASSERT_EQUAL_UINT16(0, EncoderErrors(NULL));
+    EncoderEdgeFromIsr(NULL, ENCODER_CHANNEL_A, 0);
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,274 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, María Ayelén Vega Caro <ayelenvegacaro@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+
+PRUEBAS A REALIZAR
+- Una tecla sin otros gestos informa la pulsación apenas se presiona
+- Una tecla con pulsación larga informa la pulsación corta al soltarla antes de tiempo
+- Una tecla con pulsación larga la informa una sola vez al cumplirse el tiempo
+- Dos pulsaciones seguidas se informan como doble pulsación
+- Una sola pulsación de una tecla con doble pulsación se informa al vencer la espera
+- Dos teclas presionadas juntas se informan como acorde y no generan otros gestos
+- Una tecla de acorde presionada sola se informa al vencer el tiempo del acorde
+- Una tecla presionada se repite con un período cada vez más corto hasta el mínimo
+- Las repeticiones demoradas se informan todas
+- Manteniendo presionada la tecla se recorren los 60 minutos en menos de tres segundos
+- Parámetros inválidos
+
+*********************************************************************************************************************/
+
+/** @file  test_gesture.c
+ ** @brief Pruebas del reconocedor de gestos de las teclas
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+#include "unity.h"
+#include "gesture.h"
+
+/* === Macros definitions ========================================================================================== */
+#define KEYS       5 //!< Cantidad de teclas
+#define KEY_PLAIN  0 //!< Tecla sin otros gestos
+#define KEY_LONG   1 //!< Tecla con pulsación larga
+#define KEY_UP     2 //!< Tecla que se repite y forma acordes
+#define KEY_DOWN   3 //!< Tecla que se repite y forma acordes
+#define KEY_DOUBLE 4 //!< Tecla con doble pulsación
+
+#define LONG_MS    1000
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations ===============================================================================*/
+/**
+ * @brief Guarda los gestos informados
+ */
+static void Handler(gesture_event_t event, void * context);
+
+/**
+ * @brief Informa un cambio de una tecla en el momento actual
+ *
+ * @param key Número de tecla
+ * @param pressed Indica si la tecla se presionó o se soltó
+ */
+static void Key(uint8_t key, bool pressed);
+
+/**
+ * @brief Avanza el tiempo y procesa los gestos que dependen de él
+ *
+ * @param ms Milisegundos a avanzar
+ * @return uint32_t Tiempo de espera que devuelve GestureProcess
+ */
+static uint32_t Process(uint32_t ms);
+
+/* === Private variable definitions ================================================================================ */
+static const struct gesture_config_s config = {
+    .long_ms = {[KEY_LONG] = LONG_MS},
+    .double_keys = 1 << KEY_DOUBLE,
+    .chord_keys = (1 << KEY_UP) | (1 << KEY_DOWN),
+    .repeat_keys = (1 << KEY_UP) | (1 << KEY_DOWN),
+    .double_ms = 300,
+    .chord_ms = 50,
+    .repeat_delay_ms = 400,
+    .repeat_start_ms = 150,
+    .repeat_min_ms = 25,
+    .repeat_accel = 15,
+};
+
+static gesture_t gesture;
+static struct gesture_event_s events[80];
+static uint8_t event_count;
+static uint32_t now;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+static void Handler(gesture_event_t event, void * context) {
+    (void)context;
+    if (event_count < sizeof(events) / sizeof(events[0])) {
+        events[event_count] = *event;
+    }
+    event_count++;
+}
+
+static void Key(uint8_t key, bool pressed) {
+    GestureKey(gesture, key, pressed, now, Handler, NULL);
+}
+
+static uint32_t Process(uint32_t ms) {
+    now += ms;
+    return GestureProcess(gesture, now, Handler, NULL);
+}
+
+/* === Public function implementation ============================================================================== */
+void setUp(void) {
+    gesture = GestureCreate(&config, KEYS);
+    event_count = 0;
+    now = 1000;
+}
+
+// Una tecla sin otros gestos informa la pulsación apenas se presiona
+void test_plain_key_reports_on_press(void) {
+    Key(KEY_PLAIN, true);
+    TEST_ASSERT_EQUAL_UINT8(1, event_count);
+    TEST_ASSERT_EQUAL(GESTURE_PRESS, events[0].kind);
+    TEST_ASSERT_EQUAL_UINT8(KEY_PLAIN, events[0].key);
+    TEST_ASSERT_EQUAL_UINT32(1000, events[0].timestamp);
+    TEST_ASSERT_EQUAL_UINT32(GESTURE_NO_DEADLINE, Process(5000));
+    Key(KEY_PLAIN, false);
+    TEST_ASSERT_EQUAL_UINT8(1, event_count);
+}
+
+// Una tecla con pulsación larga informa la pulsación corta al soltarla antes de tiempo
+void test_long_key_short_press(void) {
+    Key(KEY_LONG, true);
+    TEST_ASSERT_EQUAL_UINT32(LONG_MS - 200, Process(200));
+    TEST_ASSERT_EQUAL_UINT8(0, event_count);
+    Key(KEY_LONG, false);
+    TEST_ASSERT_EQUAL_UINT8(1, event_count);
+    TEST_ASSERT_EQUAL(GESTURE_PRESS, events[0].kind);
+    TEST_ASSERT_EQUAL_UINT32(1000, events[0].timestamp);
+    TEST_ASSERT_EQUAL_UINT32(GESTURE_NO_DEADLINE, Process(LONG_MS));
+}
+
+// Una tecla con pulsación larga la informa una sola vez al cumplirse el tiempo
+void test_long_press(void) {
+    Key(KEY_LONG, true);
+    TEST_ASSERT_EQUAL_UINT32(GESTURE_NO_DEADLINE, Process(LONG_MS + 10));
+    TEST_ASSERT_EQUAL_UINT8(1, event_count);
+    TEST_ASSERT_EQUAL(GESTURE_LONG, events[0].kind);
+    TEST_ASSERT_EQUAL_UINT32(1000 + LONG_MS, events[0].timestamp);
+    Process(LONG_MS);
+    Key(KEY_LONG, false);
+    TEST_ASSERT_EQUAL_UINT8(1, event_count);
+}
+
+// Dos pulsaciones seguidas se informan como doble pulsación
+void test_double_press(void) {
+    Key(KEY_DOUBLE, true);
+    Process(80);
+    Key(KEY_DOUBLE, false);
+    TEST_ASSERT_EQUAL_UINT32(200, Process(100));
+    Key(KEY_DOUBLE, true);
+    TEST_ASSERT_EQUAL_UINT8(1, event_count);
+    TEST_ASSERT_EQUAL(GESTURE_DOUBLE, events[0].kind);
+    TEST_ASSERT_EQUAL_UINT32(1180, events[0].timestamp);
+    Process(80);
+    Key(KEY_DOUBLE, false);
+    TEST_ASSERT_EQUAL_UINT32(GESTURE_NO_DEADLINE, Process(1000));
+    TEST_ASSERT_EQUAL_UINT8(1, event_count);
+}
+
+// Una sola pulsación de una tecla con doble pulsación se informa al vencer la espera
+void test_single_press_of_double_key(void) {
+    Key(KEY_DOUBLE, true);
+    Process(80);
+    Key(KEY_DOUBLE, false);
+    TEST_ASSERT_EQUAL_UINT32(1, Process(299));
+    TEST_ASSERT_EQUAL_UINT8(0, event_count);
+    TEST_ASSERT_EQUAL_UINT32(GESTURE_NO_DEADLINE, Process(1));
+    TEST_ASSERT_EQUAL_UINT8(1, event_count);
+    TEST_ASSERT_EQUAL(GESTURE_PRESS, events[0].kind);
+    TEST_ASSERT_EQUAL_UINT32(1000, events[0].timestamp);
+}
+
+// Dos teclas presionadas juntas se informan como acorde y no generan otros gestos
+void test_chord(void) {
+    Key(KEY_UP, true);
+    TEST_ASSERT_EQUAL_UINT32(30, Process(20));
+    Key(KEY_DOWN, true);
+    TEST_ASSERT_EQUAL_UINT8(1, event_count);
+    TEST_ASSERT_EQUAL(GESTURE_CHORD, events[0].kind);
+    TEST_ASSERT_EQUAL_UINT8(KEY_UP, events[0].key);
+    TEST_ASSERT_EQUAL_UINT8(KEY_DOWN, events[0].other);
+    TEST_ASSERT_EQUAL_UINT32(GESTURE_NO_DEADLINE, Process(2000));
+    Key(KEY_UP, false);
+    Key(KEY_DOWN, false);
+    TEST_ASSERT_EQUAL_UINT8(1, event_count);
+}
+
+// Una tecla de acorde presionada sola se informa al vencer el tiempo del acorde
+void test_chord_key_alone(void) {
+    Key(KEY_UP, true);
+    TEST_ASSERT_EQUAL_UINT8(0, event_count);
+    TEST_ASSERT_EQUAL_UINT32(400 - 50, Process(50));
+    TEST_ASSERT_EQUAL_UINT8(1, event_count);
+    TEST_ASSERT_EQUAL(GESTURE_PRESS, events[0].kind);
+    TEST_ASSERT_EQUAL_UINT32(1000, events[0].timestamp);
+    // La otra tecla ya no forma un acorde
+    Key(KEY_DOWN, true);
+    TEST_ASSERT_EQUAL_UINT8(1, event_count);
+    Process(50);
+    TEST_ASSERT_EQUAL_UINT8(2, event_count);
+    TEST_ASSERT_EQUAL(GESTURE_PRESS, events[1].kind);
+    TEST_ASSERT_EQUAL_UINT8(KEY_DOWN, events[1].key);
+}
+
+// Una tecla presionada se repite con un período cada vez más corto hasta el mínimo
+void test_repeat_accelerates(void) {
+    static const uint32_t expected[] = {1400, 1550, 1678, 1787, 1880};
+    uint32_t previous;
+
+    Key(KEY_UP, true);
+    Process(50);
+    for (uint8_t index = 0; index < sizeof(expected) / sizeof(expected[0]); index++) {
+        Process(expected[index] - now);
+        TEST_ASSERT_EQUAL_UINT8(index + 2, event_count);
+        TEST_ASSERT_EQUAL(GESTURE_REPEAT, events[index + 1].kind);
+        TEST_ASSERT_EQUAL_UINT16(index + 1, events[index + 1].count);
+        TEST_ASSERT_EQUAL_UINT32(expected[index], events[index + 1].timestamp);
+    }
+    for (uint8_t step = 0; step < 30; step++) {
+        previous = Process(0);
+        Process(previous);
+    }
+    TEST_ASSERT_EQUAL_UINT32(25, Process(0));
+    Key(KEY_UP, false);
+    TEST_ASSERT_EQUAL_UINT32(GESTURE_NO_DEADLINE, Process(1000));
+}
+
+// Las repeticiones demoradas se informan todas
+void test_late_repeats_are_not_lost(void) {
+    Key(KEY_UP, true);
+    Process(50);
+    Process(1880 - now);
+    TEST_ASSERT_EQUAL_UINT8(6, event_count);
+    TEST_ASSERT_EQUAL_UINT16(5, events[5].count);
+}
+
+// Manteniendo presionada la tecla se recorren los 60 minutos en menos de tres segundos
+void test_sixty_steps_in_less_than_three_seconds(void) {
+    Key(KEY_UP, true);
+    while (now < 1000 + 2500) {
+        Process(10);
+    }
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT8(60, event_count);
+}
+
+// Parámetros inválidos
+void test_invalid_parameters(void) {
+    static const struct gesture_config_s no_minimum = {.repeat_keys = 1};
+
+    TEST_ASSERT_NULL(GestureCreate(NULL, KEYS));
+    TEST_ASSERT_NULL(GestureCreate(&config, 0));
+    TEST_ASSERT_NULL(GestureCreate(&config, GESTURE_MAX_KEYS + 1));
+    TEST_ASSERT_NULL(GestureCreate(&no_minimum, KEYS));
+    gesture = GestureCreate(&config, KEYS);
+    Key(KEYS, true);
+    TEST_ASSERT_EQUAL_UINT8(0, event_count);
+    TEST_ASSERT_EQUAL_UINT32(GESTURE_NO_DEADLINE, GestureProcess(NULL, now, Handler, NULL));
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,346 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, María Ayelén Vega Caro <ayelenvegacaro@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+
+PRUEBAS A REALIZAR
+- Los contadores verticales necesitan 4 muestras iguales seguidas para cambiar una entrada
+- Una muestra distinta en el medio reinicia la cuenta de esa entrada solamente
+- Los contadores verticales filtran 32 entradas a la vez
+- Sin flancos no se informa nada y no hay que despertarse por tiempo
+- Una pulsación se informa al cuarto muestreo con el momento del primer flanco
+- Los rebotes de una pulsación se informan como una sola pulsación
+- Un pulso más corto que el muestreo no se informa y el muestreo se detiene
+- Varias teclas que cambian juntas se informan en el mismo muestreo
+- Al soltar la tecla se informa la liberación
+- La pulsación larga se informa una sola vez y el tiempo de espera apunta a ella
+- Soltar antes del tiempo de pulsación larga la cancela
+- Cada flanco despierta a la tarea y los flancos anteriores a la configuración se procesan igual
+- Si la cola se llena se cuentan los flancos perdidos
+- Parámetros inválidos
+
+*********************************************************************************************************************/
+
+/** @file  test_keypad.c
+ ** @brief Pruebas del procesamiento de las teclas con un controlador de interrupciones simulado
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+#include "unity.h"
+#include "keypad.h"
+#include "interrupt_sim.h"
+
+/* === Macros definitions ========================================================================================== */
+#define KEYS     6 //!< Cantidad de teclas
+#define SCAN_MS  5 //!< Período de muestreo configurado
+#define LONG_KEY 4 //!< Tecla con pulsación larga
+#define LONG_MS  3000
+
+/* === Private data type declarations ============================================================================== */
+//! Acción informada por el teclado
+typedef struct action_s {
+    uint8_t key;
+    keypad_action_t action;
+    uint32_t timestamp;
+} action_t;
+
+/* === Private function declarations ===============================================================================*/
+/**
+ * @brief Rutina de atención de las teclas, guarda el flanco como lo haría el firmware
+ *
+ * @param line Línea que interrumpió, igual al número de tecla
+ */
+static void KeyIsr(uint8_t line);
+
+/**
+ * @brief Lee todas las teclas juntas, con los mismos bits que el puerto de la placa
+ */
+static uint32_t Read(void);
+
+/**
+ * @brief Simula el aviso a la tarea contando las notificaciones
+ *
+ * @param context No se usa
+ */
+static void Notify(void * context);
+
+/**
+ * @brief Guarda las acciones informadas por el teclado
+ */
+static void Handler(uint8_t key, keypad_action_t action, uint32_t timestamp, void * context);
+
+/**
+ * @brief Avanza el tiempo y procesa el teclado como la tarea al despertarse
+ *
+ * @param ms Milisegundos a avanzar
+ * @return uint32_t Tiempo de espera que devuelve KeypadProcess
+ */
+static uint32_t Process(uint32_t ms);
+
+/**
+ * @brief Procesa el teclado las veces necesarias para aceptar un cambio
+ *
+ * @return uint32_t Tiempo de espera que devuelve el último procesamiento
+ */
+static uint32_t Settle(void);
+
+/* === Private variable definitions ================================================================================ */
+static const uint8_t bits[KEYS] = {9, 8, 15, 14, 12, 13};
+
+static const struct keypad_config_s config = {
+    .scan_ms = SCAN_MS,
+    .long_press_ms = {[LONG_KEY] = LONG_MS},
+};
+
+static keypad_t keypad;
+static action_t actions[16];
+static uint8_t action_count;
+static uint32_t notifications;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+static void KeyIsr(uint8_t line) {
+    KeypadEdgeFromIsr(keypad, line, InterruptSimNow());
+}
+
+static uint32_t Read(void) {
+    uint32_t value = 0;
+    for (uint8_t key = 0; key < KEYS; key++) {
+        if (InterruptSimGetLevel(key)) {
+            value |= 1UL << bits[key];
+        }
+    }
+    return value;
+}
+
+static void Notify(void * context) {
+    (void)context;
+    notifications++;
+}
+
+static void Handler(uint8_t key, keypad_action_t action, uint32_t timestamp, void * context) {
+    (void)context;
+    if (action_count < sizeof(actions) / sizeof(actions[0])) {
+        actions[action_count].key = key;
+        actions[action_count].action = action;
+        actions[action_count].timestamp = timestamp;
+        action_count++;
+    }
+}
+
+static uint32_t Process(uint32_t ms) {
+    InterruptSimAdvance(ms);
+    return KeypadProcess(keypad, InterruptSimNow(), Handler, NULL);
+}
+
+static uint32_t Settle(void) {
+    Process(0);
+    for (uint8_t sample = 1; sample < KEYPAD_DEBOUNCE_SAMPLES - 1; sample++) {
+        Process(SCAN_MS);
+    }
+    return Process(SCAN_MS);
+}
+
+/* === Public function implementation ============================================================================== */
+void setUp(void) {
+    InterruptSimCreate();
+    keypad = KeypadCreate(bits, KEYS, Read);
+    for (uint8_t key = 0; key < KEYS; key++) {
+        InterruptSimConnect(key, KeyIsr);
+    }
+    KeypadStart(keypad, &config, Notify, NULL);
+    action_count = 0;
+    notifications = 0;
+    InterruptSimAdvance(1000);
+}
+
+// Los contadores verticales necesitan 4 muestras iguales seguidas para cambiar una entrada
+void test_debounce_needs_four_samples(void) {
+    keypad_debounce_t debounce = {0};
+
+    TEST_ASSERT_EQUAL_HEX32(0, KeypadDebounce(&debounce, 0x01));
+    TEST_ASSERT_EQUAL_HEX32(0, KeypadDebounce(&debounce, 0x01));
+    TEST_ASSERT_EQUAL_HEX32(0, KeypadDebounce(&debounce, 0x01));
+    TEST_ASSERT_EQUAL_HEX32(0x01, KeypadDebounce(&debounce, 0x01));
+    TEST_ASSERT_EQUAL_HEX32(0x01, debounce.state);
+    TEST_ASSERT_EQUAL_HEX32(0, KeypadDebounce(&debounce, 0x01));
+}
+
+// Una muestra distinta en el medio reinicia la cuenta de esa entrada solamente
+void test_debounce_glitch_restarts_count(void) {
+    keypad_debounce_t debounce = {0};
+
+    KeypadDebounce(&debounce, 0x03);
+    KeypadDebounce(&debounce, 0x03);
+    KeypadDebounce(&debounce, 0x02);
+    TEST_ASSERT_EQUAL_HEX32(0x02, KeypadDebounce(&debounce, 0x03));
+    TEST_ASSERT_EQUAL_HEX32(0, KeypadDebounce(&debounce, 0x03));
+    TEST_ASSERT_EQUAL_HEX32(0, KeypadDebounce(&debounce, 0x03));
+    TEST_ASSERT_EQUAL_HEX32(0x01, KeypadDebounce(&debounce, 0x03));
+    TEST_ASSERT_EQUAL_HEX32(0x03, debounce.state);
+}
+
+// Los contadores verticales filtran 32 entradas a la vez
+void test_debounce_32_inputs(void) {
+    keypad_debounce_t debounce = {.state = 0x0000FFFF};
+
+    for (uint8_t sample = 1; sample < KEYPAD_DEBOUNCE_SAMPLES; sample++) {
+        TEST_ASSERT_EQUAL_HEX32(0, KeypadDebounce(&debounce, 0xFFFF0000));
+    }
+    TEST_ASSERT_EQUAL_HEX32(0xFFFFFFFF, KeypadDebounce(&debounce, 0xFFFF0000));
+    TEST_ASSERT_EQUAL_HEX32(0xFFFF0000, debounce.state);
+    TEST_ASSERT_EQUAL_HEX32(0, debounce.count0 | debounce.count1);
+}
+
+// Sin flancos no se informa nada y no hay que despertarse por tiempo
+void test_no_edges(void) {
+    TEST_ASSERT_EQUAL_UINT32(KEYPAD_NO_DEADLINE, Process(100));
+    TEST_ASSERT_EQUAL_UINT8(0, action_count);
+}
+
+// Una pulsación se informa al cuarto muestreo con el momento del primer flanco
+void test_press_reported_after_four_samples(void) {
+    InterruptSimSetLevel(2, true);
+    TEST_ASSERT_EQUAL_UINT32(SCAN_MS, Process(0));
+    TEST_ASSERT_EQUAL_UINT32(2, Process(3));
+    TEST_ASSERT_EQUAL_UINT32(SCAN_MS, Process(2));
+    TEST_ASSERT_EQUAL_UINT32(SCAN_MS, Process(SCAN_MS));
+    TEST_ASSERT_EQUAL_UINT8(0, action_count);
+    TEST_ASSERT_EQUAL_UINT32(KEYPAD_NO_DEADLINE, Process(SCAN_MS));
+    TEST_ASSERT_EQUAL_UINT8(1, action_count);
+    TEST_ASSERT_EQUAL_UINT8(2, actions[0].key);
+    TEST_ASSERT_EQUAL(KEYPAD_PRESSED, actions[0].action);
+    TEST_ASSERT_EQUAL_UINT32(1000, actions[0].timestamp);
+    TEST_ASSERT_TRUE(KeypadIsPressed(keypad, 2));
+}
+
+// Los rebotes de una pulsación se informan como una sola pulsación
+void test_bouncing_press_reported_once(void) {
+    InterruptSimBounce(1, true, 4);
+    Settle();
+    Process(SCAN_MS);
+    TEST_ASSERT_EQUAL_UINT8(1, action_count);
+    TEST_ASSERT_EQUAL(KEYPAD_PRESSED, actions[0].action);
+    TEST_ASSERT_EQUAL_UINT32(1000, actions[0].timestamp);
+}
+
+// Un pulso más corto que el muestreo no se informa y el muestreo se detiene
+void test_glitch_is_ignored(void) {
+    InterruptSimSetLevel(0, true);
+    TEST_ASSERT_EQUAL_UINT32(SCAN_MS, Process(0));
+    TEST_ASSERT_EQUAL_UINT32(SCAN_MS, Process(SCAN_MS));
+    InterruptSimSetLevel(0, false);
+    TEST_ASSERT_EQUAL_UINT32(KEYPAD_NO_DEADLINE, Process(SCAN_MS));
+    TEST_ASSERT_EQUAL_UINT8(0, action_count);
+    TEST_ASSERT_FALSE(KeypadIsPressed(keypad, 0));
+}
+
+// Varias teclas que cambian juntas se informan en el mismo muestreo
+void test_simultaneous_keys(void) {
+    InterruptSimSetLevel(5, true);
+    InterruptSimSetLevel(0, true);
+    InterruptSimSetLevel(3, true);
+    TEST_ASSERT_EQUAL_UINT32(KEYPAD_NO_DEADLINE, Settle());
+    TEST_ASSERT_EQUAL_UINT8(3, action_count);
+    // Se informan en el orden de los bits del puerto
+    TEST_ASSERT_EQUAL_UINT8(0, actions[0].key);
+    TEST_ASSERT_EQUAL_UINT8(5, actions[1].key);
+    TEST_ASSERT_EQUAL_UINT8(3, actions[2].key);
+}
+
+// Al soltar la tecla se informa la liberación
+void test_release_reported(void) {
+    InterruptSimSetLevel(3, true);
+    Settle();
+    InterruptSimAdvance(200);
+    InterruptSimBounce(3, false, 2);
+    TEST_ASSERT_EQUAL_UINT32(KEYPAD_NO_DEADLINE, Settle());
+    TEST_ASSERT_EQUAL_UINT8(2, action_count);
+    TEST_ASSERT_EQUAL(KEYPAD_RELEASED, actions[1].action);
+    TEST_ASSERT_EQUAL_UINT32(1215, actions[1].timestamp);
+    TEST_ASSERT_FALSE(KeypadIsPressed(keypad, 3));
+}
+
+// La pulsación larga se informa una sola vez y el tiempo de espera apunta a ella
+void test_long_press(void) {
+    InterruptSimSetLevel(LONG_KEY, true);
+    TEST_ASSERT_EQUAL_UINT32(LONG_MS - 3 * SCAN_MS, Settle());
+    TEST_ASSERT_EQUAL_UINT32(KEYPAD_NO_DEADLINE, Process(LONG_MS - 3 * SCAN_MS));
+    Process(LONG_MS);
+    TEST_ASSERT_EQUAL_UINT8(2, action_count);
+    TEST_ASSERT_EQUAL(KEYPAD_LONG_PRESSED, actions[1].action);
+    TEST_ASSERT_EQUAL_UINT32(1000 + LONG_MS, actions[1].timestamp);
+}
+
+// Soltar antes del tiempo de pulsación larga la cancela
+void test_release_cancels_long_press(void) {
+    InterruptSimSetLevel(LONG_KEY, true);
+    Settle();
+    InterruptSimAdvance(1000);
+    InterruptSimSetLevel(LONG_KEY, false);
+    TEST_ASSERT_EQUAL_UINT32(KEYPAD_NO_DEADLINE, Settle());
+    TEST_ASSERT_EQUAL_UINT32(KEYPAD_NO_DEADLINE, Process(LONG_MS));
+    TEST_ASSERT_EQUAL_UINT8(2, action_count);
+    TEST_ASSERT_EQUAL(KEYPAD_RELEASED, actions[1].action);
+}
+
+// Cada flanco despierta a la tarea y los flancos anteriores a la configuración se procesan igual
+void test_notifications(void) {
+    InterruptSimBounce(0, true, 2);
+    TEST_ASSERT_EQUAL_UINT32(5, notifications);
+    TEST_ASSERT_EQUAL_UINT32(5, InterruptSimCalls());
+
+    keypad = KeypadCreate(bits, KEYS, Read);
+    InterruptSimSetLevel(1, true);
+    KeypadStart(keypad, &config, Notify, NULL);
+    TEST_ASSERT_EQUAL_UINT32(6, notifications);
+    Settle();
+    // El muestreo lee todas las teclas, así que también toma la que quedó presionada antes de crear el teclado
+    TEST_ASSERT_EQUAL_UINT8(2, action_count);
+    TEST_ASSERT_EQUAL_UINT8(1, actions[0].key);
+    TEST_ASSERT_EQUAL_UINT8(0, actions[1].key);
+}
+
+// Si la cola se llena se cuentan los flancos perdidos
+void test_queue_overrun(void) {
+    InterruptSimBounce(5, true, KEYPAD_QUEUE_SIZE);
+    TEST_ASSERT_EQUAL_UINT16(2 * KEYPAD_QUEUE_SIZE + 1 - (KEYPAD_QUEUE_SIZE - 1), KeypadOverruns(keypad));
+}
+
+// Parámetros inválidos
+void test_invalid_parameters(void) {
+    static const uint8_t repeated[] = {3, 3};
+    static const uint8_t outside[] = {KEYPAD_MAX_KEYS};
+    static const struct keypad_config_s no_scan = {0};
+
+    TEST_ASSERT_NULL(KeypadCreate(bits, 0, Read));
+    TEST_ASSERT_NULL(KeypadCreate(bits, KEYPAD_MAX_KEYS + 1, Read));
+    TEST_ASSERT_NULL(KeypadCreate(NULL, KEYS, Read));
+    TEST_ASSERT_NULL(KeypadCreate(bits, KEYS, NULL));
+    TEST_ASSERT_NULL(KeypadCreate(repeated, 2, Read));
+    TEST_ASSERT_NULL(KeypadCreate(outside, 1, Read));
+    keypad = KeypadCreate(bits, KEYS, Read);
+    TEST_ASSERT_EQUAL_INT(-1, KeypadStart(keypad, NULL, Notify, NULL));
+    TEST_ASSERT_EQUAL_INT(-1, KeypadStart(keypad, &no_scan, Notify, NULL));
+    TEST_ASSERT_EQUAL_INT(-1, KeypadStart(NULL, &config, Notify, NULL));
+    KeypadStart(keypad, &config, Notify, NULL);
+    KeypadEdgeFromIsr(keypad, KEYS, 0);
+    TEST_ASSERT_EQUAL_UINT32(KEYPAD_NO_DEADLINE, Process(SCAN_MS));
+    TEST_ASSERT_FALSE(KeypadIsPressed(keypad, KEYS));
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,223 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, María Ayelén Vega Caro <ayelenvegacaro@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+
+PRUEBAS A REALIZAR
+- Al crear el driver se envía la secuencia de inicialización del MAX7219 en una sola transferencia
+- Al escribir un valor y enviar el cuadro se mandan todos los dígitos en una sola transferencia
+- Si el cuadro no cambió no se envía nada
+- Refrescar la pantalla sin parpadeo no vuelve a enviar el cuadro
+- Con dígitos parpadeando solo se envía un cuadro cuando cambia la fase del parpadeo
+- Los puntos encendidos se envían en el bit DP
+- Avanzar varios barridos de una vez envía solamente el cuadro final
+- Una animación avanzada de una vez termina y avisa
+- Un display con driver multiplexado no acepta DisplayFlush ni DisplayAdvance
+
+*********************************************************************************************************************/
+
+/** @file  test_max7219.c
+ ** @brief Pruebas del driver de display por SPI para el MAX7219
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+#include "unity.h"
+#include "display.h"
+#include "max7219.h"
+#include "spi_capture.h"
+
+/* === Macros definitions ========================================================================================== */
+#define DISPLAY_DIGITS 4 //!< Cantidad de dígitos de la pantalla
+#define INTENSITY      8 //!< Brillo configurado en las pruebas
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations ===============================================================================*/
+/**
+ * @brief Refresca la pantalla una cantidad dada de barridos completos
+ *
+ * @param sweeps Cantidad de barridos
+ */
+static void SimulateSweeps(uint32_t sweeps);
+
+/**
+ * @brief Función de finalización que cuenta cuántas veces terminó una animación
+ *
+ * @param display Display que terminó la animación
+ * @param context Contador de finalizaciones
+ */
+static void AnimationDone(display_t display, void * context);
+
+//! Funciones vacías para un driver multiplexado
+static void DigitsTurnOff(void);
+static void SegmentsUpdate(uint8_t segments);
+static void DigitsTurnOn(uint8_t digit);
+
+/* === Private variable definitions ================================================================================ */
+static display_t display;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+static void SimulateSweeps(uint32_t sweeps) {
+    for (uint32_t i = 0; i < sweeps * DISPLAY_DIGITS; i++) {
+        DisplayRefresh(display);
+    }
+}
+
+static void AnimationDone(display_t display, void * context) {
+    (void)display;
+    (*(uint8_t *)context)++;
+}
+
+static void DigitsTurnOff(void) {
+}
+
+static void SegmentsUpdate(uint8_t segments) {
+    (void)segments;
+}
+
+static void DigitsTurnOn(uint8_t digit) {
+    (void)digit;
+}
+
+/* === Public function implementation ============================================================================== */
+void setUp(void) {
+    display = DisplayCreate(DISPLAY_DIGITS, Max7219DriverCreate(SpiCaptureCreate(), DISPLAY_DIGITS, INTENSITY));
+}
+
+// Al crear el driver se envía la secuencia de inicialización del MAX7219 en una sola transferencia
+void test_create_sends_setup_sequence(void) {
+    static const uint8_t expected[] = {0x0F, 0x00, 0x09, 0x00, 0x0B, 0x03, 0x0A, 0x08, 0x0C, 0x01};
+    TEST_ASSERT_EQUAL_UINT16(1, SpiCaptureTransfers());
+    TEST_ASSERT_EQUAL_UINT16(sizeof(expected), SpiCaptureSize());
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, SpiCaptureStream(), sizeof(expected));
+}
+
+// Al escribir un valor y enviar el cuadro se mandan todos los dígitos en una sola transferencia
+void test_write_and_flush_sends_whole_frame(void) {
+    static const uint8_t expected[] = {0x01, 0x30, 0x02, 0x6D, 0x03, 0x79, 0x04, 0x33};
+    uint8_t value[] = {1, 2, 3, 4};
+
+    SpiCaptureClear();
+    DisplayWrite(display, value, sizeof(value));
+    TEST_ASSERT_EQUAL_INT(1, DisplayFlush(display));
+    TEST_ASSERT_EQUAL_UINT16(1, SpiCaptureTransfers());
+    TEST_ASSERT_EQUAL_UINT16(sizeof(expected), SpiCaptureSize());
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, SpiCaptureStream(), sizeof(expected));
+}
+
+// Si el cuadro no cambió no se envía nada
+void test_flush_without_changes_sends_nothing(void) {
+    uint8_t value[] = {1, 2, 3, 4};
+
+    DisplayWrite(display, value, sizeof(value));
+    DisplayFlush(display);
+    SpiCaptureClear();
+    DisplayWrite(display, value, sizeof(value));
+    TEST_ASSERT_EQUAL_INT(0, DisplayFlush(display));
+    TEST_ASSERT_EQUAL_UINT16(0, SpiCaptureTransfers());
+}
+
+// Refrescar la pantalla sin parpadeo no vuelve a enviar el cuadro
+void test_refresh_without_flashing_sends_frame_once(void) {
+    uint8_t value[] = {1, 2, 3, 4};
+
+    SpiCaptureClear();
+    DisplayWrite(display, value, sizeof(value));
+    SimulateSweeps(100);
+    TEST_ASSERT_EQUAL_UINT16(1, SpiCaptureTransfers());
+}
+
+// Con dígitos parpadeando solo se envía un cuadro cuando cambia la fase del parpadeo
+void test_refresh_with_flashing_sends_frame_on_phase_change(void) {
+    static const uint8_t blanked[] = {0x01, 0x00, 0x02, 0x00, 0x03, 0x79, 0x04, 0x33};
+    uint8_t value[] = {1, 2, 3, 4};
+
+    DisplayWrite(display, value, sizeof(value));
+    DisplayFlashDigits(display, 0, 1, 5);
+    SpiCaptureClear();
+    SimulateSweeps(1);
+    TEST_ASSERT_EQUAL_UINT16(1, SpiCaptureTransfers());
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(blanked, SpiCaptureStream(), sizeof(blanked));
+    SimulateSweeps(9);
+    TEST_ASSERT_EQUAL_UINT16(3, SpiCaptureTransfers());
+}
+
+// Los puntos encendidos se envían en el bit DP
+void test_point_is_sent_in_dp_bit(void) {
+    static const uint8_t expected[] = {0x01, 0x30, 0x02, 0xED, 0x03, 0x79, 0x04, 0x33};
+    uint8_t value[] = {1, 2, 3, 4};
+
+    DisplayWrite(display, value, sizeof(value));
+    DisplaySetPoint(display, 1, true);
+    SpiCaptureClear();
+    DisplayFlush(display);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, SpiCaptureStream(), sizeof(expected));
+}
+
+// Avanzar varios barridos de una vez envía solamente el cuadro final
+void test_advance_sends_only_final_frame(void) {
+    static const uint8_t blanked[] = {0x01, 0x00, 0x02, 0x00, 0x03, 0x79, 0x04, 0x33};
+    uint8_t value[] = {1, 2, 3, 4};
+
+    DisplayWrite(display, value, sizeof(value));
+    DisplayFlashDigits(display, 0, 1, 5);
+    SpiCaptureClear();
+    TEST_ASSERT_EQUAL_INT(1, DisplayAdvance(display, 0));
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(blanked, SpiCaptureStream(), sizeof(blanked));
+    TEST_ASSERT_EQUAL_INT(0, DisplayAdvance(display, 4));
+    TEST_ASSERT_EQUAL_INT(1, DisplayAdvance(display, 1));
+    TEST_ASSERT_EQUAL_INT(0, DisplayAdvance(display, 10));
+    TEST_ASSERT_EQUAL_UINT16(2, SpiCaptureTransfers());
+    TEST_ASSERT_EQUAL_UINT16(5, DisplaySweepsToChange(display));
+}
+
+// Una animación avanzada de una vez termina y avisa
+void test_advance_finishes_animation(void) {
+    static const uint8_t segments[] = {0x01, 0x01, 0x01, 0x01, 0x08, 0x08, 0x08, 0x08};
+    static const struct display_animation_s animation = {
+        .segments = segments,
+        .duration = 3,
+        .frames = 2,
+        .width = DISPLAY_DIGITS,
+        .stride = DISPLAY_DIGITS,
+    };
+    uint8_t done = 0;
+
+    DisplayPlay(display, &animation, AnimationDone, &done);
+    DisplayAdvance(display, 5);
+    TEST_ASSERT_TRUE(DisplayIsPlaying(display));
+    TEST_ASSERT_EQUAL_UINT16(1, DisplaySweepsToChange(display));
+    DisplayAdvance(display, 1);
+    TEST_ASSERT_FALSE(DisplayIsPlaying(display));
+    TEST_ASSERT_EQUAL_UINT8(1, done);
+}
+
+// Un display con driver multiplexado no acepta DisplayFlush ni DisplayAdvance
+void test_flush_with_multiplexed_driver_fails(void) {
+    static const struct display_driver_s driver = {
+        .DigitsTurnOff = DigitsTurnOff,
+        .SegmentsUpdate = SegmentsUpdate,
+        .DigitsTurnOn = DigitsTurnOn,
+    };
+    display_t multiplexed = DisplayCreate(DISPLAY_DIGITS, &driver);
+    TEST_ASSERT_EQUAL_INT(-1, DisplayFlush(multiplexed));
+    TEST_ASSERT_EQUAL_INT(-1, DisplayAdvance(multiplexed, 1));
+    TEST_ASSERT_EQUAL_INT(-1, DisplayAdvance(NULL, 1));
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,204 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, María Ayelén Vega Caro <ayelenvegacaro@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+
+PRUEBAS A REALIZAR
+- Sin vencimientos no hay límite para dormir
+- Se duerme hasta el vencimiento más cercano y se cuenta cuál fue
+- Un vencimiento que ya pasó duerme un milisegundo
+- Se cuentan los sueños, el tiempo dormido, el sueño más largo y los despertares anticipados
+- Con la pantalla apagada una hora se despierta una vez por minuto y el reloj no atrasa
+
+*********************************************************************************************************************/
+
+/** @file  test_power.c
+ ** @brief Pruebas de la planificación del bajo consumo con un sueño simulado
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+#include "unity.h"
+#include "power.h"
+#include "clock.h"
+#include "display_scan.h"
+
+/* === Macros definitions ========================================================================================== */
+#define TICKS_PER_SECOND 1000 //!< Un tick del reloj por milisegundo, como en el equipo
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations ===============================================================================*/
+//! Funciones vacías para el driver de la alarma
+static void AlarmActivate(void);
+static void AlarmDeactivate(void);
+
+/**
+ * @brief Simula el funcionamiento con la pantalla apagada durmiendo siempre hasta el próximo vencimiento
+ *
+ * @param clock Reloj que avanza con el tiempo dormido
+ * @param scan Planificador de barrido que cuenta la inactividad
+ * @param ms Tiempo a simular en milisegundos
+ */
+static void SimulateSleeps(clock_t clock, display_scan_t scan, uint32_t ms);
+
+/* === Private variable definitions ================================================================================ */
+static const struct clock_alarm_driver_s alarm_driver = {
+    .AlarmActivate = AlarmActivate,
+    .AlarmDeactivate = AlarmDeactivate,
+};
+
+static const struct display_scan_config_s scan_config = {
+    .flicker_free_hz = {60, 70, 80, 100},
+    .idle_divider = 2,
+    .idle_timeout_ms = 10000,
+    .blank_timeout_ms = 20000,
+    .blank_period_ms = 500,
+};
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+static void AlarmActivate(void) {
+}
+
+static void AlarmDeactivate(void) {
+}
+
+static void SimulateSleeps(clock_t clock, display_scan_t scan, uint32_t ms) {
+    uint32_t deadlines[POWER_DEADLINES];
+    uint32_t sleep;
+
+    while (ms > 0) {
+        deadlines[POWER_DEADLINE_ALARM] = ClockTicksToChange(clock, CLOCK_CHANGED_ALARM);
+        deadlines[POWER_DEADLINE_BLINK] = POWER_NO_DEADLINE;
+        deadlines[POWER_DEADLINE_INACTIVITY] = DisplayScanMsToNextState(scan);
+        deadlines[POWER_DEADLINE_ROLLOVER] = ClockTicksToChange(clock, CLOCK_CHANGED_MINUTES);
+        sleep = PowerPlanSleep(deadlines);
+        sleep = (sleep < ms) ? sleep : ms;
+
+        PowerSleepEnter(sleep);
+        for (uint32_t tick = 0; tick < sleep; tick++) {
+            ClockNewTick(clock);
+        }
+        DisplayScanElapsed(scan, sleep);
+        PowerSleepExit(sleep);
+        ms -= sleep;
+    }
+}
+
+/* === Public function implementation ============================================================================== */
+void setUp(void) {
+    PowerResetStats();
+}
+
+// Sin vencimientos no hay límite para dormir
+void test_no_deadlines(void) {
+    static const uint32_t deadlines[POWER_DEADLINES] = {
+        POWER_NO_DEADLINE,
+        POWER_NO_DEADLINE,
+        POWER_NO_DEADLINE,
+        POWER_NO_DEADLINE,
+    };
+    power_stats_t stats;
+
+    TEST_ASSERT_EQUAL_UINT32(POWER_NO_DEADLINE, PowerPlanSleep(deadlines));
+    TEST_ASSERT_EQUAL_UINT32(POWER_NO_DEADLINE, PowerPlanSleep(NULL));
+    PowerGetStats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.plans);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.reasons[POWER_DEADLINE_ROLLOVER]);
+}
+
+// Se duerme hasta el vencimiento más cercano y se cuenta cuál fue
+void test_sleep_until_earliest_deadline(void) {
+    uint32_t deadlines[POWER_DEADLINES] = {
+        [POWER_DEADLINE_ALARM] = 120000,
+        [POWER_DEADLINE_BLINK] = POWER_NO_DEADLINE,
+        [POWER_DEADLINE_INACTIVITY] = 30000,
+        [POWER_DEADLINE_ROLLOVER] = 42000,
+    };
+    power_stats_t stats;
+
+    TEST_ASSERT_EQUAL_UINT32(30000, PowerPlanSleep(deadlines));
+    deadlines[POWER_DEADLINE_BLINK] = 250;
+    TEST_ASSERT_EQUAL_UINT32(250, PowerPlanSleep(deadlines));
+    PowerGetStats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(2, stats.plans);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.reasons[POWER_DEADLINE_INACTIVITY]);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.reasons[POWER_DEADLINE_BLINK]);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.reasons[POWER_DEADLINE_ALARM]);
+}
+
+// Un vencimiento que ya pasó duerme un milisegundo
+void test_past_deadline_sleeps_one_ms(void) {
+    static const uint32_t deadlines[POWER_DEADLINES] = {
+        POWER_NO_DEADLINE,
+        0,
+        POWER_NO_DEADLINE,
+        1000,
+    };
+
+    TEST_ASSERT_EQUAL_UINT32(1, PowerPlanSleep(deadlines));
+}
+
+// Se cuentan los sueños, el tiempo dormido, el sueño más largo y los despertares anticipados
+void test_sleep_accounting(void) {
+    power_stats_t stats;
+
+    PowerSleepEnter(500);
+    PowerSleepExit(500);
+    PowerSleepEnter(60000);
+    PowerSleepExit(1200);
+    PowerSleepEnter(POWER_NO_DEADLINE);
+    PowerSleepExit(800);
+    PowerGetStats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(3, stats.sleeps);
+    TEST_ASSERT_EQUAL_UINT32(2500, stats.slept_ms);
+    TEST_ASSERT_EQUAL_UINT32(1200, stats.longest_ms);
+    TEST_ASSERT_EQUAL_UINT32(2, stats.early);
+
+    PowerResetStats();
+    PowerGetStats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.sleeps);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.slept_ms);
+}
+
+// Con la pantalla apagada una hora se despierta una vez por minuto y el reloj no atrasa
+void test_blank_hour_wakes_once_per_minute(void) {
+    static const clock_time_t start = {.time = {.hours = {2, 1}, .minutes = {0, 0}, .seconds = {0, 0}}};
+    static const clock_time_t alarm = {.time = {.hours = {2, 1}, .minutes = {0, 3}, .seconds = {0, 0}}};
+    static const clock_time_t end = {.time = {.hours = {3, 1}, .minutes = {0, 0}, .seconds = {0, 0}}};
+    clock_t clock = ClockCreate(TICKS_PER_SECOND, 5, &alarm_driver);
+    display_scan_t scan = DisplayScanCreate(&scan_config, 4, 3);
+    clock_time_t now;
+    power_stats_t stats;
+
+    ClockSetTime(clock, &start);
+    ClockSetAlarm(clock, &alarm);
+    SimulateSleeps(clock, scan, 3600000);
+
+    TEST_ASSERT_TRUE(ClockGetTime(clock, &now));
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(end.bcd, now.bcd, sizeof(end.bcd));
+    TEST_ASSERT_TRUE(ClockIsAlarmActive(clock));
+    TEST_ASSERT_EQUAL(DISPLAY_SCAN_BLANK, DisplayScanState(scan));
+    PowerGetStats(&stats);
+    // Un despertar por minuto, más los dos cambios de estado de la pantalla
+    TEST_ASSERT_EQUAL_UINT32(62, stats.sleeps);
+    TEST_ASSERT_EQUAL_UINT32(3600000, stats.slept_ms);
+    TEST_ASSERT_EQUAL_UINT32(60000, stats.longest_ms);
+    TEST_ASSERT_EQUAL_UINT32(2, stats.reasons[POWER_DEADLINE_INACTIVITY]);
+}
+
+/* === End of documentation ======================================================================================== */
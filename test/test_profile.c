@@ -0,0 +1,141 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, María Ayelén Vega Caro <ayelenvegacaro@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+
+PRUEBAS A REALIZAR
+- Sin mediciones todo queda en cero
+- Se guardan la cantidad, el mínimo, el máximo y el promedio
+- Cada duración cae en la cubeta de su potencia de dos
+- Las duraciones enormes caen en la última cubeta
+- Las sondas inexistentes se ignoran
+- Un tramo entre PROFILE_BEGIN y PROFILE_END se mide con el reloj de la computadora
+
+*********************************************************************************************************************/
+
+/** @file  test_profile.c
+ ** @brief Pruebas del perfilador, que en la computadora cuenta nanosegundos
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+#include "unity.h"
+#include "profile.h"
+
+/* === Macros definitions ========================================================================================== */
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations ===============================================================================*/
+
+/* === Private variable definitions ================================================================================ */
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+/* === Public function implementation ============================================================================== */
+void setUp(void) {
+    PROFILE_INIT();
+}
+
+// Sin mediciones todo queda en cero
+void test_no_samples(void) {
+    profile_stats_t stats;
+
+    TEST_ASSERT_TRUE(ProfileGetStats(PROFILE_DISPLAY_REFRESH, &stats));
+    TEST_ASSERT_EQUAL_UINT32(0, stats.count);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.min);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.max);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.mean);
+    TEST_ASSERT_EACH_EQUAL_UINT32(0, stats.buckets, PROFILE_BUCKETS);
+}
+
+// Se guardan la cantidad, el mínimo, el máximo y el promedio
+void test_min_max_mean(void) {
+    profile_stats_t stats;
+
+    ProfileRecord(PROFILE_CHANGE_MODE, 300);
+    ProfileRecord(PROFILE_CHANGE_MODE, 100);
+    ProfileRecord(PROFILE_CHANGE_MODE, 800);
+    ProfileGetStats(PROFILE_CHANGE_MODE, &stats);
+    TEST_ASSERT_EQUAL_UINT32(3, stats.count);
+    TEST_ASSERT_EQUAL_UINT32(100, stats.min);
+    TEST_ASSERT_EQUAL_UINT32(800, stats.max);
+    TEST_ASSERT_EQUAL_UINT32(400, stats.mean);
+    ProfileGetStats(PROFILE_INPUT, &stats);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.count);
+}
+
+// Cada duración cae en la cubeta de su potencia de dos
+void test_log2_buckets(void) {
+    profile_stats_t stats;
+
+    ProfileRecord(PROFILE_INPUT, 0);
+    ProfileRecord(PROFILE_INPUT, 1);
+    ProfileRecord(PROFILE_INPUT, 2);
+    ProfileRecord(PROFILE_INPUT, 3);
+    ProfileRecord(PROFILE_INPUT, 1023);
+    ProfileRecord(PROFILE_INPUT, 1024);
+    ProfileGetStats(PROFILE_INPUT, &stats);
+    TEST_ASSERT_EQUAL_UINT32(2, stats.buckets[0]);
+    TEST_ASSERT_EQUAL_UINT32(2, stats.buckets[1]);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.buckets[9]);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.buckets[10]);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.min);
+}
+
+// Las duraciones enormes caen en la última cubeta
+void test_huge_durations_in_last_bucket(void) {
+    profile_stats_t stats;
+
+    ProfileRecord(PROFILE_CLOCK_SYNC, 1UL << (PROFILE_BUCKETS - 1));
+    ProfileRecord(PROFILE_CLOCK_SYNC, UINT32_MAX);
+    ProfileGetStats(PROFILE_CLOCK_SYNC, &stats);
+    TEST_ASSERT_EQUAL_UINT32(2, stats.buckets[PROFILE_BUCKETS - 1]);
+    TEST_ASSERT_EQUAL_UINT32(UINT32_MAX, stats.max);
+    // El promedio se suma con 64 bits, así no se desborda
+    TEST_ASSERT_EQUAL_UINT32((UINT32_MAX + (1ULL << (PROFILE_BUCKETS - 1))) / 2, stats.mean);
+}
+
+// Las sondas inexistentes se ignoran
+void test_invalid_probe(void) {
+    profile_stats_t stats;
+
+    ProfileRecord(PROFILE_PROBES, 100);
+    TEST_ASSERT_FALSE(ProfileGetStats(PROFILE_PROBES, &stats));
+    TEST_ASSERT_FALSE(ProfileGetStats(PROFILE_INPUT, NULL));
+}
+
+// Un tramo entre PROFILE_BEGIN y PROFILE_END se mide con el reloj de la computadora
+void test_scoped_markers(void) {
+    profile_stats_t stats;
+    volatile uint32_t sum = 0;
+
+    for (uint8_t round = 0; round < 4; round++) {
+        PROFILE_BEGIN(PROFILE_DISPLAY_REFRESH);
+        for (uint32_t index = 0; index < 100000; index++) {
+            sum += index;
+        }
+        PROFILE_END(PROFILE_DISPLAY_REFRESH);
+    }
+    ProfileGetStats(PROFILE_DISPLAY_REFRESH, &stats);
+    TEST_ASSERT_EQUAL_UINT32(4, stats.count);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, stats.min);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(stats.max, stats.mean);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(stats.min, stats.mean);
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,192 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, María Ayelén Vega Caro <ayelenvegacaro@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+
+PRUEBAS A REALIZAR
+- No se crea el monitor con una configuración inválida
+- Los barridos a tiempo no pierden vencimientos y miden el período real
+- Un vencimiento que todavía no llegó cuenta como atendido a tiempo
+- El atraso cae en la cubeta de su potencia de dos y cuenta un vencimiento perdido por período
+- Después de reiniciar la medición no se mide el período a través de la pausa
+- Una ventana sobrecargada se registra y una sin sobrecarga vuelve al nivel normal
+- La sobrecarga sostenida degrada y después pide el reinicio, que ya no se retira
+
+*********************************************************************************************************************/
+
+/** @file  test_scan_monitor.c
+ ** @brief Pruebas del monitor de los vencimientos del barrido
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+#include "unity.h"
+#include "scan_monitor.h"
+
+/* === Macros definitions ========================================================================================== */
+#define PERIOD 2 //!< Período del barrido en ms, como el de cuatro dígitos a 100 Hz
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations ===============================================================================*/
+/**
+ * @brief Simula los barridos de una ventana completa
+ *
+ * @param monitor Monitor
+ * @param late Atraso en ms con el que se atiende cada barrido
+ * @param late_scans Cantidad de barridos atrasados, los demás se atienden a tiempo
+ * @return scan_monitor_level_t Nivel al cerrar la ventana
+ */
+static scan_monitor_level_t RunWindow(scan_monitor_t monitor, uint32_t late, uint16_t late_scans);
+
+/* === Private variable definitions ================================================================================ */
+static const struct scan_monitor_config_s config = {
+    .window = 10,
+    .overrun_misses = 3,
+    .degrade_windows = 2,
+    .reset_windows = 4,
+};
+
+static uint32_t deadline;
+static scan_monitor_t monitor;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+static scan_monitor_level_t RunWindow(scan_monitor_t monitor, uint32_t late, uint16_t late_scans) {
+    scan_monitor_level_t level = SCAN_MONITOR_OK;
+
+    for (uint16_t scan = 0; scan < config.window; scan++) {
+        deadline += PERIOD;
+        level = ScanMonitorScan(monitor, deadline + ((scan < late_scans) ? late : 0), deadline, PERIOD);
+        // El núcleo saltea los vencimientos que ya pasaron
+        deadline += ((scan < late_scans) ? late : 0) / PERIOD * PERIOD;
+    }
+    return level;
+}
+
+/* === Public function implementation ============================================================================== */
+void setUp(void) {
+    deadline = 1000;
+    monitor = ScanMonitorCreate(&config);
+}
+
+// No se crea el monitor con una configuración inválida
+void test_invalid_config(void) {
+    static const struct scan_monitor_config_s no_window = {.window = 0, .overrun_misses = 1, .degrade_windows = 1};
+    static const struct scan_monitor_config_s reset_first = {
+        .window = 10,
+        .overrun_misses = 1,
+        .degrade_windows = 3,
+        .reset_windows = 2,
+    };
+
+    TEST_ASSERT_NULL(ScanMonitorCreate(NULL));
+    TEST_ASSERT_NULL(ScanMonitorCreate(&no_window));
+    TEST_ASSERT_NULL(ScanMonitorCreate(&reset_first));
+    TEST_ASSERT_FALSE(ScanMonitorGetStats(NULL, NULL));
+}
+
+// Los barridos a tiempo no pierden vencimientos y miden el período real
+void test_on_time_scans(void) {
+    scan_monitor_stats_t stats;
+
+    TEST_ASSERT_EQUAL(SCAN_MONITOR_OK, RunWindow(monitor, 0, 0));
+    TEST_ASSERT_TRUE(ScanMonitorGetStats(monitor, &stats));
+    TEST_ASSERT_EQUAL_UINT32(10, stats.scans);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.missed);
+    TEST_ASSERT_EQUAL_UINT32(10, stats.late[0]);
+    TEST_ASSERT_EQUAL_UINT16(PERIOD, stats.period_min);
+    TEST_ASSERT_EQUAL_UINT16(PERIOD, stats.period_max);
+    TEST_ASSERT_EQUAL(SCAN_MONITOR_OK, stats.worst);
+}
+
+// Un vencimiento que todavía no llegó cuenta como atendido a tiempo
+void test_early_scan_is_on_time(void) {
+    scan_monitor_stats_t stats;
+
+    ScanMonitorScan(monitor, 999, 1000, PERIOD);
+    ScanMonitorGetStats(monitor, &stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.late[0]);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.missed);
+}
+
+// El atraso cae en la cubeta de su potencia de dos y cuenta un vencimiento perdido por período
+void test_late_scans(void) {
+    scan_monitor_stats_t stats;
+
+    ScanMonitorScan(monitor, 1001, 1000, PERIOD);
+    ScanMonitorScan(monitor, 1005, 1002, PERIOD);
+    ScanMonitorScan(monitor, 1011, 1006, PERIOD);
+    ScanMonitorScan(monitor, 1108, 1008, PERIOD);
+    ScanMonitorGetStats(monitor, &stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.late[1]);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.late[2]);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.late[3]);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.late[SCAN_MONITOR_BUCKETS - 1]);
+    // 0 + 1 + 2 + 50 vencimientos salteados
+    TEST_ASSERT_EQUAL_UINT32(53, stats.missed);
+    TEST_ASSERT_EQUAL_UINT16(4, stats.period_min);
+    TEST_ASSERT_EQUAL_UINT16(97, stats.period_max);
+}
+
+// Después de reiniciar la medición no se mide el período a través de la pausa
+void test_restart_skips_interval(void) {
+    scan_monitor_stats_t stats;
+
+    ScanMonitorScan(monitor, 1000, 1000, PERIOD);
+    ScanMonitorRestart(monitor);
+    ScanMonitorScan(monitor, 6000, 6000, 4);
+    ScanMonitorScan(monitor, 6004, 6004, 4);
+    ScanMonitorGetStats(monitor, &stats);
+    TEST_ASSERT_EQUAL_UINT16(4, stats.period_min);
+    TEST_ASSERT_EQUAL_UINT16(4, stats.period_max);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.missed);
+}
+
+// Una ventana sobrecargada se registra y una sin sobrecarga vuelve al nivel normal
+void test_single_overrun_logs(void) {
+    scan_monitor_stats_t stats;
+
+    // Dos barridos atrasados no alcanzan, tres sí
+    TEST_ASSERT_EQUAL(SCAN_MONITOR_OK, RunWindow(monitor, PERIOD, 2));
+    TEST_ASSERT_EQUAL(SCAN_MONITOR_LOG, RunWindow(monitor, PERIOD, 3));
+    TEST_ASSERT_EQUAL(SCAN_MONITOR_OK, RunWindow(monitor, 0, 0));
+    ScanMonitorGetStats(monitor, &stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.overrun_windows);
+    TEST_ASSERT_EQUAL_UINT8(0, stats.streak);
+    TEST_ASSERT_EQUAL(SCAN_MONITOR_OK, stats.level);
+    TEST_ASSERT_EQUAL(SCAN_MONITOR_LOG, stats.worst);
+}
+
+// La sobrecarga sostenida degrada y después pide el reinicio, que ya no se retira
+void test_sustained_overrun_escalates(void) {
+    scan_monitor_stats_t stats;
+
+    TEST_ASSERT_EQUAL(SCAN_MONITOR_LOG, RunWindow(monitor, 3 * PERIOD, 1));
+    TEST_ASSERT_EQUAL(SCAN_MONITOR_DEGRADE, RunWindow(monitor, 3 * PERIOD, 1));
+    TEST_ASSERT_EQUAL(SCAN_MONITOR_DEGRADE, RunWindow(monitor, 3 * PERIOD, 1));
+    // Dentro de la ventana el nivel no cambia hasta cerrarla
+    TEST_ASSERT_EQUAL(SCAN_MONITOR_DEGRADE, ScanMonitorScan(monitor, deadline + 20, deadline, PERIOD));
+    deadline += 20;
+    TEST_ASSERT_EQUAL(SCAN_MONITOR_RESET, RunWindow(monitor, 3 * PERIOD, 1));
+    TEST_ASSERT_EQUAL(SCAN_MONITOR_RESET, RunWindow(monitor, 0, 0));
+    ScanMonitorGetStats(monitor, &stats);
+    TEST_ASSERT_EQUAL(SCAN_MONITOR_RESET, stats.level);
+    TEST_ASSERT_EQUAL(SCAN_MONITOR_RESET, stats.worst);
+    TEST_ASSERT_EQUAL_UINT32(4, stats.overrun_windows);
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,195 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, María Ayelén Vega Caro <ayelenvegacaro@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+
+PRUEBAS A REALIZAR
+- La primera muestra no tiene con qué comparar y deja el uso en cero
+- El uso del procesador sale de la diferencia entre dos muestras
+- El uso se calcula bien aunque el contador dé la vuelta
+- Cada tarea se compara con la suya aunque cambie el orden de la lista
+- Las tareas que no entran se cuentan y no se muestran
+- Se guardan la pila libre, el heap y el costo de la muestra
+- La foto se vuelca como texto y se corta si no entra
+
+*********************************************************************************************************************/
+
+/** @file  test_stats.c
+ ** @brief Pruebas de las estadísticas de ejecución
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+#include "unity.h"
+#include "stats.h"
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations ===============================================================================*/
+
+/* === Private variable definitions ================================================================================ */
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+/* === Public function implementation ============================================================================== */
+void setUp(void) {
+    StatsReset();
+}
+
+// La primera muestra no tiene con qué comparar y deja el uso en cero
+void test_first_sample_has_no_usage(void) {
+    static const stats_sample_t tasks[] = {
+        {.id = 1, .name = "Active", .runtime = 5000, .stack_free = 200},
+        {.id = 2, .name = "IDLE", .runtime = 95000, .stack_free = 90},
+    };
+    stats_snapshot_t snapshot;
+
+    StatsSample(tasks, 2, 100000, 512, 256);
+    StatsGetSnapshot(&snapshot);
+    TEST_ASSERT_EQUAL_UINT32(1, snapshot.samples);
+    TEST_ASSERT_EQUAL_UINT32(0, snapshot.elapsed);
+    TEST_ASSERT_EQUAL_UINT8(2, snapshot.count);
+    TEST_ASSERT_EQUAL_UINT16(0, snapshot.tasks[0].cpu);
+    TEST_ASSERT_EQUAL_UINT16(0, snapshot.tasks[1].cpu);
+}
+
+// El uso del procesador sale de la diferencia entre dos muestras
+void test_usage_from_difference(void) {
+    stats_sample_t tasks[] = {
+        {.id = 1, .name = "Active", .runtime = 5000, .stack_free = 200},
+        {.id = 2, .name = "IDLE", .runtime = 95000, .stack_free = 90},
+    };
+    stats_snapshot_t snapshot;
+
+    StatsSample(tasks, 2, 100000, 512, 256);
+    // En el segundo siguiente la tarea activa usó el 12,5% del procesador
+    tasks[0].runtime += 125000;
+    tasks[1].runtime += 875000;
+    StatsSample(tasks, 2, 1100000, 512, 256);
+    StatsGetSnapshot(&snapshot);
+    TEST_ASSERT_EQUAL_UINT32(1000000, snapshot.elapsed);
+    TEST_ASSERT_EQUAL_UINT16(125, snapshot.tasks[0].cpu);
+    TEST_ASSERT_EQUAL_UINT16(875, snapshot.tasks[1].cpu);
+}
+
+// El uso se calcula bien aunque el contador dé la vuelta
+void test_usage_across_counter_wrap(void) {
+    stats_sample_t tasks[] = {
+        {.id = 1, .name = "Active", .runtime = UINT32_MAX - 1000, .stack_free = 200},
+        {.id = 2, .name = "IDLE", .runtime = 3000, .stack_free = 90},
+    };
+    stats_snapshot_t snapshot;
+
+    StatsSample(tasks, 2, UINT32_MAX - 500, 512, 256);
+    tasks[0].runtime += 300000;
+    tasks[1].runtime += 700000;
+    StatsSample(tasks, 2, UINT32_MAX - 500 + 1000000, 512, 256);
+    StatsGetSnapshot(&snapshot);
+    TEST_ASSERT_EQUAL_UINT32(1000000, snapshot.elapsed);
+    TEST_ASSERT_EQUAL_UINT16(300, snapshot.tasks[0].cpu);
+    TEST_ASSERT_EQUAL_UINT16(700, snapshot.tasks[1].cpu);
+}
+
+// Cada tarea se compara con la suya aunque cambie el orden de la lista
+void test_tasks_matched_by_id(void) {
+    stats_sample_t tasks[] = {
+        {.id = 1, .name = "Active", .runtime = 1000, .stack_free = 200},
+        {.id = 2, .name = "IDLE", .runtime = 9000, .stack_free = 90},
+    };
+    stats_sample_t swapped[2];
+    stats_snapshot_t snapshot;
+
+    StatsSample(tasks, 2, 10000, 512, 256);
+    swapped[0] = tasks[1];
+    swapped[1] = tasks[0];
+    swapped[0].runtime += 9900;
+    swapped[1].runtime += 100;
+    StatsSample(swapped, 2, 20000, 512, 256);
+    StatsGetSnapshot(&snapshot);
+    TEST_ASSERT_EQUAL_STRING("IDLE", snapshot.tasks[0].name);
+    TEST_ASSERT_EQUAL_UINT16(990, snapshot.tasks[0].cpu);
+    TEST_ASSERT_EQUAL_STRING("Active", snapshot.tasks[1].name);
+    TEST_ASSERT_EQUAL_UINT16(10, snapshot.tasks[1].cpu);
+}
+
+// Las tareas que no entran se cuentan y no se muestran
+void test_extra_tasks_dropped(void) {
+    stats_sample_t tasks[STATS_MAX_TASKS + 2];
+    stats_snapshot_t snapshot;
+
+    memset(tasks, 0, sizeof(tasks));
+    for (uint8_t index = 0; index < STATS_MAX_TASKS + 2; index++) {
+        tasks[index].id = index + 1;
+    }
+    StatsSample(tasks, STATS_MAX_TASKS + 2, 1000, 512, 256);
+    StatsGetSnapshot(&snapshot);
+    TEST_ASSERT_EQUAL_UINT8(STATS_MAX_TASKS, snapshot.count);
+    TEST_ASSERT_EQUAL_UINT8(2, snapshot.dropped);
+    TEST_ASSERT_EQUAL_UINT32(STATS_MAX_TASKS, snapshot.tasks[STATS_MAX_TASKS - 1].id);
+}
+
+// Se guardan la pila libre, el heap y el costo de la muestra
+void test_stack_heap_and_cost(void) {
+    static const stats_sample_t tasks[] = {
+        {.id = 1, .name = "Active", .runtime = 5000, .stack_free = 37},
+    };
+    stats_snapshot_t snapshot;
+
+    StatsSample(tasks, 1, 100000, 640, 128);
+    StatsSampleCost(42);
+    StatsSampleCost(17);
+    StatsGetSnapshot(&snapshot);
+    TEST_ASSERT_EQUAL_UINT16(37, snapshot.tasks[0].stack_free);
+    TEST_ASSERT_EQUAL_UINT32(640, snapshot.heap_free);
+    TEST_ASSERT_EQUAL_UINT32(128, snapshot.heap_min);
+    TEST_ASSERT_EQUAL_UINT32(17, snapshot.overhead);
+    TEST_ASSERT_EQUAL_UINT32(42, snapshot.overhead_max);
+}
+
+// La foto se vuelca como texto y se corta si no entra
+void test_format_dump(void) {
+    stats_sample_t tasks[] = {
+        {.id = 1, .name = "Active", .runtime = 0, .stack_free = 200},
+        {.id = 2, .name = "IDLE", .runtime = 0, .stack_free = 90},
+    };
+    stats_snapshot_t snapshot;
+    char text[160];
+    char small[20];
+    size_t length;
+
+    StatsSample(tasks, 2, 0, 512, 256);
+    tasks[0].runtime = 125;
+    tasks[1].runtime = 875;
+    StatsSample(tasks, 2, 1000, 512, 256);
+    StatsSampleCost(12);
+    StatsGetSnapshot(&snapshot);
+    length = StatsFormat(&snapshot, text, sizeof(text));
+    TEST_ASSERT_EQUAL(strlen(text), length);
+    TEST_ASSERT_EQUAL_STRING("Active            12.5%   200\n"
+                             "IDLE              87.5%    90\n"
+                             "heap 512/256 costo 12/12\n",
+                             text);
+
+    TEST_ASSERT_EQUAL(sizeof(small) - 1, StatsFormat(&snapshot, small, sizeof(small)));
+    TEST_ASSERT_EQUAL_STRING("Active            1", small);
+    TEST_ASSERT_EQUAL(0, StatsFormat(NULL, small, sizeof(small)));
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,127 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, María Ayelén Vega Caro <ayelenvegacaro@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+
+PRUEBAS A REALIZAR
+- Antes de inicializarlo no se registra nada
+- Al inicializarlo el anillo queda vacío y marcado para reconocer el volcado
+- Cada registro guarda el momento, el tipo, el número y el dato
+- Con el anillo lleno se pisan los registros más viejos
+- Los nombres se guardan por número y se cortan si son muy largos
+
+*********************************************************************************************************************/
+
+/** @file  test_trace.c
+ ** @brief Pruebas del registro de eventos del núcleo
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+#include "unity.h"
+#include "trace.h"
+
+/* === Macros definitions ========================================================================================== */
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations ===============================================================================*/
+/**
+ * @brief Contador libre simulado, que avanza 10 cuentas por lectura
+ */
+static uint32_t FakeClock(void);
+
+/* === Private variable definitions ================================================================================ */
+static uint32_t fake_now;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+static uint32_t FakeClock(void) {
+    fake_now += 10;
+    return fake_now;
+}
+
+/* === Public function implementation ============================================================================== */
+void setUp(void) {
+    fake_now = 0;
+}
+
+// Antes de inicializarlo no se registra nada
+void test_no_records_before_init(void) {
+    TraceRecord(TRACE_TASK_IN, 1, 0);
+    TEST_ASSERT_EQUAL_UINT32(0, TraceGetBuffer()->written);
+}
+
+// Al inicializarlo el anillo queda vacío y marcado para reconocer el volcado
+void test_init(void) {
+    const trace_buffer_t * trace = TraceGetBuffer();
+
+    TraceInit(FakeClock, 1000000);
+    TraceRecord(TRACE_TASK_IN, 1, 0);
+    TraceInit(FakeClock, 1000000);
+    TEST_ASSERT_EQUAL_HEX32(TRACE_MAGIC, trace->magic);
+    TEST_ASSERT_EQUAL_UINT32(1000000, trace->hz);
+    TEST_ASSERT_EQUAL_UINT32(0, trace->written);
+    TEST_ASSERT_EQUAL(8, sizeof(trace_record_t));
+}
+
+// Cada registro guarda el momento, el tipo, el número y el dato
+void test_record_fields(void) {
+    const trace_buffer_t * trace = TraceGetBuffer();
+
+    TraceInit(FakeClock, 1000000);
+    TraceRecord(TRACE_ACTIVE_POST, 3, 0x0209);
+    TraceRecord(TRACE_ACTIVE_BEGIN, 3, 0x09);
+    TEST_ASSERT_EQUAL_UINT32(2, trace->written);
+    TEST_ASSERT_EQUAL_UINT32(10, trace->records[0].timestamp);
+    TEST_ASSERT_EQUAL_UINT8(TRACE_ACTIVE_POST, trace->records[0].kind);
+    TEST_ASSERT_EQUAL_UINT8(3, trace->records[0].id);
+    TEST_ASSERT_EQUAL_HEX16(0x0209, trace->records[0].arg);
+    TEST_ASSERT_EQUAL_UINT32(20, trace->records[1].timestamp);
+    TEST_ASSERT_EQUAL_UINT8(TRACE_ACTIVE_BEGIN, trace->records[1].kind);
+}
+
+// Con el anillo lleno se pisan los registros más viejos
+void test_ring_overwrites_oldest(void) {
+    const trace_buffer_t * trace = TraceGetBuffer();
+
+    TraceInit(FakeClock, 1000000);
+    for (uint32_t index = 0; index < TRACE_RECORDS + 3; index++) {
+        TraceRecord(TRACE_TASK_IN, (uint8_t)index, (uint16_t)index);
+    }
+    TEST_ASSERT_EQUAL_UINT32(TRACE_RECORDS + 3, trace->written);
+    TEST_ASSERT_EQUAL_UINT16(TRACE_RECORDS + 2, trace->records[2].arg);
+    TEST_ASSERT_EQUAL_UINT16(3, trace->records[3].arg);
+    TEST_ASSERT_EQUAL_UINT32(10 * (TRACE_RECORDS + 3), trace->records[2].timestamp);
+}
+
+// Los nombres se guardan por número y se cortan si son muy largos
+void test_names(void) {
+    const trace_buffer_t * trace = TraceGetBuffer();
+
+    TraceInit(FakeClock, 1000000);
+    TraceTaskName(1, "Active");
+    TraceTaskName(2, "Un nombre demasiado largo");
+    TraceTaskName(TRACE_NAMES, "Fuera");
+    TraceObjectName(4, "Timekeeper");
+    TEST_ASSERT_EQUAL_STRING("Active", trace->tasks[1]);
+    TEST_ASSERT_EQUAL_STRING("Un nombre d", trace->tasks[2]);
+    TEST_ASSERT_EQUAL_STRING("", trace->tasks[0]);
+    TEST_ASSERT_EQUAL_STRING("Timekeeper", trace->objects[4]);
+    TEST_ASSERT_EQUAL_STRING("", trace->objects[1]);
+}
+
+/* === End of documentation ======================================================================================== */
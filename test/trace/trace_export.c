@@ -0,0 +1,205 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, María Ayelén Vega Caro <ayelenvegacaro@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file  trace_export.c
+ ** @brief Conversión en el host de un volcado del registro de eventos al formato JSON de Chrome trace
+ **
+ ** Lee el anillo que se volcó con el depurador y escribe por la salida estándar los eventos que entiende Perfetto o
+ ** chrome://tracing. Las tareas y los objetos activos aparecen como hilos de dos procesos. Cada evento encolado se une
+ ** con una flecha al momento en que el objeto lo atiende, y el largo de cada cola se dibuja como un contador, así las
+ ** esperas por otro objeto se ven de un vistazo. Se compila y ejecuta con `make trace TRACE_DUMP=trace.bin`.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include "trace.h"
+
+/* === Macros definitions ========================================================================================== */
+#define PID_TASKS   1   //!< Proceso de la línea de tiempo de las tareas
+#define PID_OBJECTS 2   //!< Proceso de la línea de tiempo de los objetos activos
+#define TID_ISR     0   //!< Hilo de las interrupciones y el sueño, el sistema operativo numera las tareas desde 1
+#define PENDING     64  //!< Eventos encolados sin atender que se recuerdan por objeto, una potencia de dos
+
+/* === Private data type declarations ============================================================================== */
+//! Eventos encolados y todavía no atendidos de un objeto activo
+typedef struct export_queue_s {
+    uint8_t kinds[PENDING]; //!< Tipo de cada evento, para reconocer los que se encolaron antes del volcado
+    uint32_t head;          //!< Eventos atendidos
+    uint32_t tail;          //!< Eventos encolados
+} export_queue_t;
+
+/* === Private function declarations =============================================================================== */
+/**
+ * @brief Escribe los nombres de los procesos y de los hilos
+ *
+ * @param trace Anillo volcado
+ */
+static void ExportNames(const trace_buffer_t * trace);
+
+/**
+ * @brief Escribe el largo de la cola de un objeto
+ *
+ * @param id Prioridad del objeto
+ * @param us Momento en microsegundos
+ * @param queue Eventos pendientes del objeto
+ */
+static void ExportDepth(uint8_t id, double us, const export_queue_t * queue);
+
+/**
+ * @brief Escribe un registro
+ *
+ * @param record Registro
+ * @param us Momento en microsegundos
+ * @param queues Eventos pendientes de cada objeto
+ */
+static void ExportRecord(const trace_record_t * record, double us, export_queue_t queues[TRACE_NAMES]);
+
+/* === Private variable definitions ================================================================================ */
+static const char * separator = "";
+
+/* === Private function definitions ================================================================================ */
+static void ExportNames(const trace_buffer_t * trace) {
+    printf("%s{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%d,\"args\":{\"name\":\"Tareas\"}}", separator,
+           PID_TASKS);
+    separator = ",\n";
+    printf("%s{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%d,\"args\":{\"name\":\"Objetos activos\"}}", separator,
+           PID_OBJECTS);
+    printf("%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%d,\"tid\":%d,\"args\":{\"name\":\"Interrupciones\"}}",
+           separator, PID_TASKS, TID_ISR);
+    for (uint8_t id = 0; id < TRACE_NAMES; id++) {
+        if (trace->tasks[id][0]) {
+            printf("%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%d,\"tid\":%u,\"args\":{\"name\":\"%.*s\"}}",
+                   separator, PID_TASKS, id, TRACE_NAME_LENGTH, trace->tasks[id]);
+        }
+        if (trace->objects[id][0]) {
+            printf("%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%d,\"tid\":%u,\"args\":{\"name\":\"%.*s\"}}",
+                   separator, PID_OBJECTS, id, TRACE_NAME_LENGTH, trace->objects[id]);
+        }
+    }
+}
+
+static void ExportDepth(uint8_t id, double us, const export_queue_t * queue) {
+    printf("%s{\"name\":\"cola %u\",\"ph\":\"C\",\"pid\":%d,\"ts\":%.3f,\"args\":{\"eventos\":%u}}", separator, id,
+           PID_OBJECTS, us, (unsigned)(queue->tail - queue->head));
+}
+
+static void ExportRecord(const trace_record_t * record, double us, export_queue_t queues[TRACE_NAMES]) {
+    export_queue_t * queue = &queues[record->id % TRACE_NAMES];
+    uint32_t flow = (uint32_t)record->id << 16;
+
+    switch (record->kind) {
+    case TRACE_TASK_IN:
+    case TRACE_TASK_OUT:
+        printf("%s{\"name\":\"corre\",\"ph\":\"%c\",\"pid\":%d,\"tid\":%u,\"ts\":%.3f}", separator,
+               (record->kind == TRACE_TASK_IN) ? 'B' : 'E', PID_TASKS, record->id, us);
+        break;
+    case TRACE_NOTIFY_ISR:
+        printf("%s{\"name\":\"notifica a %u\",\"ph\":\"i\",\"s\":\"t\",\"pid\":%d,\"tid\":%d,\"ts\":%.3f}", separator,
+               record->id, PID_TASKS, TID_ISR, us);
+        break;
+    case TRACE_SLEEP_BEGIN:
+        printf("%s{\"name\":\"duerme\",\"ph\":\"B\",\"pid\":%d,\"tid\":%d,\"ts\":%.3f,\"args\":{\"ticks\":%u}}",
+               separator, PID_TASKS, TID_ISR, us, record->arg);
+        break;
+    case TRACE_SLEEP_END:
+        printf("%s{\"name\":\"duerme\",\"ph\":\"E\",\"pid\":%d,\"tid\":%d,\"ts\":%.3f}", separator, PID_TASKS,
+               TID_ISR, us);
+        break;
+    case TRACE_ACTIVE_POST:
+        queue->kinds[queue->tail % PENDING] = record->arg & 0xFF;
+        flow |= queue->tail % 0x10000;
+        queue->tail++;
+        printf("%s{\"name\":\"encola %u\",\"ph\":\"i\",\"s\":\"t\",\"pid\":%d,\"tid\":%u,\"ts\":%.3f,"
+               "\"args\":{\"origen\":%u}}",
+               separator, record->arg & 0xFF, PID_OBJECTS, record->id, us, record->arg >> 8);
+        printf("%s{\"name\":\"espera\",\"cat\":\"cola\",\"ph\":\"s\",\"id\":%u,\"pid\":%d,\"tid\":%u,\"ts\":%.3f}",
+               separator, flow, PID_OBJECTS, record->id, us);
+        ExportDepth(record->id, us, queue);
+        break;
+    case TRACE_ACTIVE_DROP:
+        printf("%s{\"name\":\"descarta %u\",\"ph\":\"i\",\"s\":\"p\",\"pid\":%d,\"tid\":%u,\"ts\":%.3f}", separator,
+               record->arg & 0xFF, PID_OBJECTS, record->id, us);
+        break;
+    case TRACE_ACTIVE_BEGIN:
+        printf("%s{\"name\":\"evento %u\",\"ph\":\"B\",\"pid\":%d,\"tid\":%u,\"ts\":%.3f}", separator, record->arg,
+               PID_OBJECTS, record->id, us);
+        // Un evento encolado antes del volcado no tiene de dónde salir la flecha
+        if (queue->tail != queue->head && queue->kinds[queue->head % PENDING] == record->arg) {
+            flow |= queue->head % 0x10000;
+            queue->head++;
+            printf("%s{\"name\":\"espera\",\"cat\":\"cola\",\"ph\":\"f\",\"bp\":\"e\",\"id\":%u,\"pid\":%d,\"tid\":%u,"
+                   "\"ts\":%.3f}",
+                   separator, flow, PID_OBJECTS, record->id, us);
+            ExportDepth(record->id, us, queue);
+        }
+        break;
+    case TRACE_SCAN_LEVEL:
+        printf("%s{\"name\":\"barrido nivel %u\",\"ph\":\"i\",\"s\":\"g\",\"pid\":%d,\"tid\":%d,\"ts\":%.3f}",
+               separator, record->arg, PID_TASKS, TID_ISR, us);
+        break;
+    case TRACE_ACTIVE_END:
+        printf("%s{\"name\":\"evento %u\",\"ph\":\"E\",\"pid\":%d,\"tid\":%u,\"ts\":%.3f}", separator, record->arg,
+               PID_OBJECTS, record->id, us);
+        break;
+    default:
+        break;
+    }
+}
+
+/* === Public function implementation ============================================================================== */
+int main(int argc, char * argv[]) {
+    static trace_buffer_t trace;
+    static export_queue_t queues[TRACE_NAMES];
+    const trace_record_t * record;
+    FILE * file;
+    uint32_t first;
+    uint32_t previous;
+    uint64_t ticks = 0;
+
+    if (argc != 2) {
+        fprintf(stderr, "Uso: %s trace.bin > trace.json\n", argv[0]);
+        return 1;
+    }
+    file = fopen(argv[1], "rb");
+    if (file == NULL || fread(&trace, sizeof(trace), 1, file) != 1 || trace.magic != TRACE_MAGIC || trace.hz == 0) {
+        fprintf(stderr, "%s no es un volcado del registro de eventos\n", argv[1]);
+        return 1;
+    }
+    fclose(file);
+
+    // Si el anillo dio la vuelta, el registro más viejo que queda es el que sigue al último escrito
+    first = (trace.written > TRACE_RECORDS) ? trace.written - TRACE_RECORDS : 0;
+    printf("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+    ExportNames(&trace);
+    previous = trace.records[first % TRACE_RECORDS].timestamp;
+    for (uint32_t index = first; index != trace.written; index++) {
+        record = &trace.records[index % TRACE_RECORDS];
+        // Se suman las diferencias, así el contador libre puede dar la vuelta entre dos registros
+        ticks += (uint32_t)(record->timestamp - previous);
+        previous = record->timestamp;
+        ExportRecord(record, (double)ticks * 1e6 / trace.hz, queues);
+    }
+    printf("\n]}\n");
+    fprintf(stderr, "%u registros, %u perdidos\n", (unsigned)(trace.written - first), (unsigned)first);
+    return 0;
+}
+
+/* === End of documentation ======================================================================================== */